@@ -67,6 +67,13 @@ void GlobalVariables_InitCB(GlobalVariables *globals)
 }
 #endif
 
+int32 gameSin256[0x100];
+int32 gameCos256[0x100];
+int32 gameSin512[0x200];
+int32 gameCos512[0x200];
+int32 gameSin1024[0x400];
+int32 gameCos1024[0x400];
+
 void InitGameLogic(void);
 #if RETRO_USE_MOD_LOADER
 void InitModAPI(void);
@@ -145,6 +152,27 @@ void InitGameLogic(void)
     RSDK.RegisterGlobalVariables((void **)&globals, sizeof(GlobalVariables));
 #endif
 
+    // TEMPENTITY_COUNT is a build option, make sure the engine's entity list was laid out the same way
+    // (GetEntity clamps out of range slots to the last one, so the list should end exactly at ENTITY_COUNT)
+    EntityBase *firstEntity = (EntityBase *)RSDK.GetEntity(0);
+    if ((EntityBase *)RSDK.GetEntity(ENTITY_COUNT - 1) != &firstEntity[ENTITY_COUNT - 1]
+        || RSDK.GetEntity(ENTITY_COUNT) != RSDK.GetEntity(ENTITY_COUNT - 1)) {
+        LogHelpers_Print("ERROR: Entity count mismatch! The game expects %d entities (%d temp slots), the engine has a different amount", ENTITY_COUNT,
+                         TEMPENTITY_COUNT);
+
+        // every slot index the game uses would be wrong, so don't register any objects rather than letting them write into the wrong entities
+        return;
+    }
+
+    for (int32 i = 0; i < 0x400; ++i) {
+        gameSin256[i & 0xFF]   = RSDK.Sin256(i);
+        gameCos256[i & 0xFF]   = RSDK.Cos256(i);
+        gameSin512[i & 0x1FF]  = RSDK.Sin512(i);
+        gameCos512[i & 0x1FF]  = RSDK.Cos512(i);
+        gameSin1024[i & 0x3FF] = RSDK.Sin1024(i);
+        gameCos1024[i & 0x3FF] = RSDK.Cos1024(i);
+    }
+
     RSDK_REGISTER_OBJECT(Acetone);
     RSDK_REGISTER_OBJECT(ActClear);
     RSDK_REGISTER_OBJECT(AIZEggRobo);
@@ -36,6 +36,18 @@
 #endif
 #endif
 
+// Controls whether Zone records every asset requested during StageLoad & writes it out as a per-folder manifest (Manifests/<Folder>.bin)
+// Only meant for dev builds, it's not something the original game did
+#ifndef GAME_RECORD_ASSET_MANIFEST
+#define GAME_RECORD_ASSET_MANIFEST (0)
+#endif
+
+// Controls whether purely visual randomness (COSMETIC_RAND) gets its own stream, separate from the one gameplay uses
+// This lets cosmetic effects be changed or skipped without desyncing anything, but the gameplay rand sequence won't match the original game's anymore
+#ifndef GAME_SPLIT_COSMETIC_RAND
+#define GAME_SPLIT_COSMETIC_RAND (0)
+#endif
+
 #ifndef RETRO_USE_MOD_LOADER
 #define RETRO_USE_MOD_LOADER (1)
 #endif
@@ -59,12 +59,21 @@ typedef uint32 color;
 #endif
 #endif
 
+// these must match the engine's values, they're only overridable so the game can be built against an engine with more screens
+#ifndef PLAYER_COUNT
 #define PLAYER_COUNT (4)
+#endif
+
+#ifndef CAMERA_COUNT
 #define CAMERA_COUNT (4)
+#endif
 
 // 0x800 scene objects, 0x40 reserved ones, and 0x100 spare slots for creation
+// the temp range can be resized at build time, but it has to match the engine (checked in InitGameLogic)
 #define RESERVE_ENTITY_COUNT (0x40)
-#define TEMPENTITY_COUNT     (0x100)
+#ifndef TEMPENTITY_COUNT
+#define TEMPENTITY_COUNT (0x100)
+#endif
 #define SCENEENTITY_COUNT    (0x800)
 #define ENTITY_COUNT         (RESERVE_ENTITY_COUNT + SCENEENTITY_COUNT + TEMPENTITY_COUNT)
 #define TEMPENTITY_START     (ENTITY_COUNT - TEMPENTITY_COUNT)
@@ -527,7 +536,7 @@ typedef struct {
 
 typedef struct {
     uint8 type;
-    uint8 drawGroup[4];
+    uint8 drawGroup[CAMERA_COUNT];
     uint8 widthShift;
     uint8 heightShift;
     uint16 width;
@@ -1885,7 +1894,8 @@ typedef struct {
 #define RSDK_THIS_GEN()                   Entity *self = SceneInfo->entity
 #define RSDK_GET_ENTITY(slot, class)      ((Entity##class *)RSDK.GetEntity(slot))
 #define RSDK_GET_ENTITY_GEN(slot)         ((Entity *)RSDK.GetEntity(slot))
-#define CREATE_ENTITY(object, data, x, y) ((Entity##object *)RSDK.CreateEntity(object->classID, data, x, y))
+// goes through Zone_CreateTempEntity so temp range overflows get tracked & cosmetic entities get overwritten first
+#define CREATE_ENTITY(object, data, x, y) ((Entity##object *)Zone_CreateTempEntity(object->classID, data, x, y))
 
 #define INIT_STRING(string)                                                                                                                          \
     string.chars  = NULL;                                                                                                                            \
@@ -1987,4 +1997,24 @@ extern RSDKUnknownInfo *UnknownInfo;
 #endif
 extern RSDKScreenInfo *ScreenInfo;
 
+// -------------------------
+// TRIG TABLES
+// -------------------------
+
+// copies of the engine's sin/cos tables, filled from RSDK.SinX/CosX in InitGameLogic so the results are identical
+// these skip a call through the function table, so they're best used in hot code
+extern int32 gameSin256[0x100];
+extern int32 gameCos256[0x100];
+extern int32 gameSin512[0x200];
+extern int32 gameCos512[0x200];
+extern int32 gameSin1024[0x400];
+extern int32 gameCos1024[0x400];
+
+#define SIN256(angle)  (gameSin256[(angle) & 0xFF])
+#define COS256(angle)  (gameCos256[(angle) & 0xFF])
+#define SIN512(angle)  (gameSin512[(angle) & 0x1FF])
+#define COS512(angle)  (gameCos512[(angle) & 0x1FF])
+#define SIN1024(angle) (gameSin1024[(angle) & 0x3FF])
+#define COS1024(angle) (gameCos1024[(angle) & 0x3FF])
+
 #endif /* GAMELINK_H */
@@ -645,8 +645,8 @@ bool32 EncoreIntro_Cutscene_MysticStealRuby(EntityCutsceneSeq *host)
         }
         else if (host->timer == 75) {
             RSDK.SetSpriteAnimation(mystic->aniFrames, 0, &mystic->mainAnimator, true, 0);
-            Zone->cameraBoundsR[0] = 16 * RSDK.GetTileLayer(Zone->fgLayer[0])->width;
-            Zone->playerBoundsR[0] = 16 * RSDK.GetTileLayer(Zone->fgLayer[0])->width;
+            Zone->cameraBoundsR[0] = 16 * Zone->fgTileLayer[0]->width;
+            Zone->playerBoundsR[0] = 16 * Zone->fgTileLayer[0]->width;
             Zone->cameraBoundsT[0] = 784;
             Zone->playerBoundsT[0] = 784;
             mystic->direction      = FLIP_NONE;
@@ -121,7 +121,7 @@ bool32 CPZBoss_CheckMatchReset(void)
 
         foreach_all(PuyoBean, bean) { destroyEntity(bean); }
 
-        int32 layerID = RSDK.GetTileLayerID("FG High");
+        int32 layerID = Zone->fgLayer[1];
         RSDK.CopyTileLayer(layerID, 438, 150, layerID, 452, 150, 6, 2);
         SceneInfo->timeEnabled = true;
         CPZBoss_Create(NULL);
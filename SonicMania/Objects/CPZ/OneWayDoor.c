@@ -87,7 +87,7 @@ void OneWayDoor_HandlePlayerInteractions(void)
     self->state = OneWayDoor_State_MoveDown;
 
     bool32 isMMZ1 = false;
-    if (RSDK.CheckSceneFolder("MMZ") && Zone->actID == 1)
+    if (Zone_IsSceneFolder(SCENEFOLDER_MMZ) && Zone->actID == 1)
         isMMZ1 = true;
 
     bool32 isBehind = false;
@@ -122,7 +122,7 @@ void SpeedBooster_HandleInteractions(void)
 {
     RSDK_THIS(SpeedBooster);
 
-    bool32 isSSZ = RSDK.CheckSceneFolder("SSZ1") || RSDK.CheckSceneFolder("SSZ2");
+    bool32 isSSZ = Zone_IsSceneFolder(SCENEFOLDER_SSZ1 | SCENEFOLDER_SSZ2);
 
     foreach_active(Player, player)
     {
@@ -184,10 +184,10 @@ void Button_StageLoad(void)
     Button->hitboxV.right  = 16;
     Button->hitboxV.bottom = 3;
 
-    if (RSDK.FindObject("Eggman"))
+    if (Eggman)
         Button->hasEggman = true;
 
-    if (RSDK.FindObject("PhantomRider"))
+    if (PhantomRider)
         Button->hasPhantomRider = true;
 
     Button->sfxButton = RSDK.GetSfx("Stage/Button.wav");
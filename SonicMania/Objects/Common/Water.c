@@ -31,7 +31,7 @@ void Water_StaticUpdate(void)
             Water->waterLevelVolume = CLAMP(Water->waterLevelVolume, 0, 30);
         }
         else {
-            if (RSDK.CheckSceneFolder("HCZ") && Water->moveWaterLevel) {
+            if (Zone_IsSceneFolder(SCENEFOLDER_HCZ) && Water->moveWaterLevel) {
                 if (!(Water->waterLevelVolume % 5))
                     Camera_ShakeScreen(0, 0, 1);
                 ++Water->waterLevelVolume;
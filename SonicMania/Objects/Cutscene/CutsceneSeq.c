@@ -22,6 +22,14 @@ void CutsceneSeq_LateUpdate(void)
 {
     RSDK_THIS(CutsceneSeq);
 
+    if (self->timeline) {
+        if (CutsceneSeq_RunTimeline(self)) {
+            LogHelpers_Print("Timeline completed");
+            destroyEntity(self);
+            return;
+        }
+    }
+
     self->currentState = self->cutsceneStates[self->stateID];
     if (self->currentState) {
         SceneInfo->entity    = self->activeEntity;
@@ -37,6 +45,7 @@ void CutsceneSeq_LateUpdate(void)
         if (!self->cutsceneStates[self->stateID]) {
             LogHelpers_Print("Sequence completed");
             destroyEntity(self);
+            return;
         }
     }
 
@@ -141,6 +150,10 @@ void CutsceneSeq_CheckSkip(uint8 skipType, EntityCutsceneSeq *seq, void (*skipCa
             ++SceneInfo->listPos;
             loadNewScene = true;
         }
+        else if (skipType == SKIPTYPE_TIMELINE) {
+            if (seq && seq->timeline && seq->timelineStep < seq->timeline->stepCount)
+                CutsceneSeq_SkipTimeline(seq);
+        }
         else {
             if (skipType == SKIPTYPE_CALLBACK) {
                 StateMachine_Run(skipCallback);
@@ -179,12 +192,7 @@ void CutsceneSeq_LockPlayerControl(EntityPlayer *player)
     player->jumpHold  = false;
     player->jumpPress = false;
 
-    Player->upState        = 0;
-    Player->downState      = 0;
-    Player->leftState      = 0;
-    Player->rightState     = 0;
-    Player->jumpPressState = 0;
-    Player->jumpHoldState  = 0;
+    Player_ResetLeaderInputs();
 }
 
 void CutsceneSeq_LockAllPlayerControl(void)
@@ -223,6 +231,252 @@ void CutsceneSeq_StartSequence(void *manager, ...)
     LogHelpers_Print("Starting sequence with %d states", count);
 }
 
+bool32 CutsceneSeq_CompileTimeline(CutsceneTimeline *timeline, const char *script)
+{
+    memset(timeline, 0, sizeof(CutsceneTimeline));
+
+    int8 actorLerp[CUTSCENESEQ_ACTOR_COUNT];
+    for (int32 a = 0; a < CUTSCENESEQ_ACTOR_COUNT; ++a) actorLerp[a] = -1;
+
+    int32 frame  = 0;
+    int32 lineID = 0;
+    while (*script) {
+        char line[0x80];
+        int32 length = 0;
+        while (*script && *script != '\n') {
+            if (length < (int32)sizeof(line) - 1)
+                line[length++] = *script;
+            ++script;
+        }
+        line[length] = 0;
+        if (*script)
+            ++script;
+        ++lineID;
+
+        char command[0x10];
+        char name[0x40];
+        if (sscanf(line, "%15s", command) != 1 || command[0] == '#')
+            continue;
+
+        if (!strcmp(command, "skippable")) {
+            timeline->skippable = true;
+            continue;
+        }
+
+        if (!strcmp(command, "skip")) {
+#if RETRO_USE_MOD_LOADER
+            if (sscanf(line, "%*s %63s", name) != 1) {
+                LogHelpers_Print("Timeline line %d: expected a function name", lineID);
+                return false;
+            }
+
+            // game functions are registered with a NULL mod id
+            timeline->skipCallback = (void (*)(void))Mod.GetPublicFunction(NULL, name);
+            if (!timeline->skipCallback) {
+                LogHelpers_Print("Timeline line %d: unknown function \"%s\"", lineID, name);
+                return false;
+            }
+            continue;
+#else
+            // functions are looked up through the mod loader's public function list, there's nothing to look them up in without it
+            LogHelpers_Print("Timeline line %d: \"skip\" requires the mod loader", lineID);
+            return false;
+#endif
+        }
+
+        if (timeline->stepCount >= CUTSCENESEQ_STEP_COUNT) {
+            LogHelpers_Print("Timeline line %d: too many steps (max %d)", lineID, CUTSCENESEQ_STEP_COUNT);
+            return false;
+        }
+
+        CutsceneStep *step = &timeline->steps[timeline->stepCount];
+        step->startFrame   = frame;
+        step->prevLerp     = -1;
+
+        if (!strcmp(command, "wait")) {
+            step->type = CUTSCENESTEP_WAIT;
+            if (sscanf(line, "%*s %d", &step->duration) != 1 || step->duration < 0) {
+                LogHelpers_Print("Timeline line %d: expected a frame count", lineID);
+                return false;
+            }
+        }
+        else if (!strcmp(command, "lerp")) {
+            int32 actorID = 0;
+            step->type    = CUTSCENESTEP_LERP;
+            if (sscanf(line, "%*s %d %d %d %d", &actorID, &step->endPos.x, &step->endPos.y, &step->duration) != 4 || actorID < 0
+                || actorID >= CUTSCENESEQ_ACTOR_COUNT || step->duration < 0) {
+                LogHelpers_Print("Timeline line %d: expected <actor> <x> <y> <frames>", lineID);
+                return false;
+            }
+
+            step->actorID      = actorID;
+            step->endPos.x     = TO_FIXED(step->endPos.x);
+            step->endPos.y     = TO_FIXED(step->endPos.y);
+            step->prevLerp     = actorLerp[actorID];
+            actorLerp[actorID] = timeline->stepCount;
+        }
+        else if (!strcmp(command, "sfx")) {
+            step->type = CUTSCENESTEP_PLAYSFX;
+            if (sscanf(line, "%*s %63s", name) != 1) {
+                LogHelpers_Print("Timeline line %d: expected a sfx path", lineID);
+                return false;
+            }
+            step->sfx = RSDK.GetSfx(name);
+        }
+#if RETRO_USE_MOD_LOADER
+        else if (!strcmp(command, "call")) {
+            step->type = CUTSCENESTEP_CALLBACK;
+            if (sscanf(line, "%*s %63s", name) != 1) {
+                LogHelpers_Print("Timeline line %d: expected a function name", lineID);
+                return false;
+            }
+
+            step->callback = (void (*)(void))Mod.GetPublicFunction(NULL, name);
+            if (!step->callback) {
+                LogHelpers_Print("Timeline line %d: unknown function \"%s\"", lineID, name);
+                return false;
+            }
+        }
+#else
+        else if (!strcmp(command, "call")) {
+            LogHelpers_Print("Timeline line %d: \"call\" requires the mod loader", lineID);
+            return false;
+        }
+#endif
+        else {
+            LogHelpers_Print("Timeline line %d: unknown command \"%s\"", lineID, command);
+            return false;
+        }
+
+        memcpy(step->actorLerp, actorLerp, sizeof(actorLerp));
+        frame += step->duration;
+        ++timeline->stepCount;
+    }
+
+    timeline->duration = frame;
+    LogHelpers_Print("Compiled timeline with %d steps (%d frames)", timeline->stepCount, timeline->duration);
+    return true;
+}
+
+void CutsceneSeq_StartTimeline(void *manager, CutsceneTimeline *timeline, Entity **actors, int32 actorCount)
+{
+    if (RSDK_GET_ENTITY(SLOT_CUTSCENESEQ, CutsceneSeq)->classID)
+        return;
+
+    RSDK.ResetEntitySlot(SLOT_CUTSCENESEQ, CutsceneSeq->classID, NULL);
+    EntityCutsceneSeq *cutsceneSeq = RSDK_GET_ENTITY(SLOT_CUTSCENESEQ, CutsceneSeq);
+
+    cutsceneSeq->position.x    = 0;
+    cutsceneSeq->position.y    = 0;
+    cutsceneSeq->activeEntity  = SceneInfo->entity;
+    cutsceneSeq->managerEntity = manager;
+    cutsceneSeq->timeline      = timeline;
+    cutsceneSeq->timelineFrame = 0;
+    cutsceneSeq->timelineStep  = 0;
+#if MANIA_USE_PLUS
+    cutsceneSeq->skipType = timeline->skippable ? SKIPTYPE_TIMELINE : SKIPTYPE_DISABLED;
+#endif
+
+    for (int32 a = 0; a < CUTSCENESEQ_ACTOR_COUNT; ++a) {
+        Entity *actor = a < actorCount ? actors[a] : NULL;
+
+        cutsceneSeq->actors[a] = actor;
+        if (actor)
+            cutsceneSeq->actorOrigins[a] = actor->position;
+    }
+
+    LogHelpers_Print("Starting timeline with %d steps", timeline->stepCount);
+}
+
+void CutsceneSeq_SetTimelineActorPos(EntityCutsceneSeq *seq, int32 lerpID, int32 frame)
+{
+    CutsceneStep *step = &seq->timeline->steps[lerpID];
+    Entity *actor      = seq->actors[step->actorID];
+    if (!actor)
+        return;
+
+    Vector2 startPos = step->prevLerp >= 0 ? seq->timeline->steps[step->prevLerp].endPos : seq->actorOrigins[step->actorID];
+    int32 percent    = step->duration ? (MIN(frame - step->startFrame + 1, step->duration) << 8) / step->duration : 0x100;
+    MathHelpers_Lerp(&actor->position, percent, startPos.x, startPos.y, step->endPos.x, step->endPos.y);
+}
+
+bool32 CutsceneSeq_RunTimeline(EntityCutsceneSeq *seq)
+{
+    CutsceneTimeline *timeline = seq->timeline;
+
+    while (seq->timelineStep < timeline->stepCount) {
+        CutsceneStep *step = &timeline->steps[seq->timelineStep];
+        if (step->startFrame > seq->timelineFrame)
+            break;
+
+        switch (step->type) {
+            default:
+            case CUTSCENESTEP_WAIT: break;
+
+            case CUTSCENESTEP_LERP: CutsceneSeq_SetTimelineActorPos(seq, seq->timelineStep, seq->timelineFrame); break;
+
+            case CUTSCENESTEP_PLAYSFX: RSDK.PlaySfx(step->sfx, false, 0xFF); break;
+
+            case CUTSCENESTEP_CALLBACK:
+                SceneInfo->entity = seq->activeEntity;
+                step->callback();
+                SceneInfo->entity = (Entity *)seq;
+                break;
+        }
+
+        // step is still running, continue from here next frame
+        if (seq->timelineFrame < step->startFrame + step->duration - 1)
+            break;
+
+        ++seq->timelineStep;
+    }
+
+    ++seq->timelineFrame;
+    return seq->timelineStep >= timeline->stepCount;
+}
+
+void CutsceneSeq_SeekTimeline(EntityCutsceneSeq *seq, int32 frame)
+{
+    CutsceneTimeline *timeline = seq->timeline;
+    frame                      = CLAMP(frame, 0, timeline->duration);
+
+    // find the first step that hasn't finished by 'frame', zero-duration steps count as finished once they've started so seeking never runs them
+    // (step end frames only ever increase, so this can be a binary search)
+    int32 start = 0;
+    int32 end   = timeline->stepCount;
+    while (start < end) {
+        int32 mid          = (start + end) >> 1;
+        CutsceneStep *step = &timeline->steps[mid];
+        if (step->startFrame + step->duration <= frame)
+            start = mid + 1;
+        else
+            end = mid;
+    }
+
+    seq->timelineStep  = start;
+    seq->timelineFrame = frame;
+
+    // place every actor where its last finished lerp left it
+    if (start > 0) {
+        CutsceneStep *lastStep = &timeline->steps[start - 1];
+        for (int32 a = 0; a < CUTSCENESEQ_ACTOR_COUNT; ++a) {
+            if (lastStep->actorLerp[a] >= 0)
+                CutsceneSeq_SetTimelineActorPos(seq, lastStep->actorLerp[a], frame);
+        }
+    }
+}
+
+void CutsceneSeq_SkipTimeline(EntityCutsceneSeq *seq)
+{
+    CutsceneSeq_SeekTimeline(seq, seq->timeline->duration);
+
+    if (seq->timeline->skipCallback) {
+        SceneInfo->entity = seq->activeEntity;
+        seq->timeline->skipCallback();
+        SceneInfo->entity = (Entity *)seq;
+    }
+}
+
 #if GAME_INCLUDE_EDITOR
 void CutsceneSeq_EditorDraw(void) {}
 
@@ -4,6 +4,8 @@
 #include "Game.h"
 
 #define CUTSCENESEQ_POINT_COUNT (8)
+#define CUTSCENESEQ_STEP_COUNT  (0x40)
+#define CUTSCENESEQ_ACTOR_COUNT (8)
 
 #if MANIA_USE_PLUS
 typedef enum {
@@ -11,9 +13,38 @@ typedef enum {
     SKIPTYPE_RELOADSCN,
     SKIPTYPE_NEXTSCENE,
     SKIPTYPE_CALLBACK,
+    SKIPTYPE_TIMELINE,
 } SkipTypes;
 #endif
 
+typedef enum {
+    CUTSCENESTEP_WAIT,     // do nothing for 'duration' frames
+    CUTSCENESTEP_LERP,     // move 'actorID' from where its last lerp ended (or its starting pos) to 'endPos' over 'duration' frames
+    CUTSCENESTEP_PLAYSFX,  // play 'sfx'
+    CUTSCENESTEP_CALLBACK, // run 'callback' once, with SceneInfo->entity set to the entity that started the timeline
+} CutsceneStepTypes;
+
+// A single "compiled" timeline step, every step has a known start frame so timelines can be seeked/skipped without running them
+typedef struct {
+    uint8 type;
+    uint8 actorID;
+    uint16 sfx;
+    int32 startFrame;
+    int32 duration;
+    Vector2 endPos;
+    void (*callback)(void);
+    int8 prevLerp;                              // the previous lerp step for 'actorID', -1 if this is its first
+    int8 actorLerp[CUTSCENESEQ_ACTOR_COUNT];    // the last lerp step (up to & including this one) for each actor, -1 if none
+} CutsceneStep;
+
+typedef struct {
+    CutsceneStep steps[CUTSCENESEQ_STEP_COUNT];
+    int32 stepCount;
+    int32 duration;
+    bool32 skippable;
+    void (*skipCallback)(void);
+} CutsceneTimeline;
+
 // Object Class
 struct ObjectCutsceneSeq {
     RSDK_OBJECT
@@ -38,6 +69,11 @@ struct EntityCutsceneSeq {
     int32 skipType;
     void (*skipCallback)(void);
 #endif
+    CutsceneTimeline *timeline;
+    int32 timelineFrame;
+    int32 timelineStep;
+    Entity *actors[CUTSCENESEQ_ACTOR_COUNT];
+    Vector2 actorOrigins[CUTSCENESEQ_ACTOR_COUNT];
 };
 
 // Object Struct
@@ -77,4 +113,25 @@ void CutsceneSeq_LockAllPlayerControl(void);
 // end the states with StateMachine_None to tell it when to stop reading states
 void CutsceneSeq_StartSequence(void *manager, ...);
 
+// Timelines
+// Compiles a timeline script (one step per line) into 'timeline', should be done during StageLoad. Returns false if the script has errors
+// wait <frames>
+// lerp <actor> <x> <y> <frames>
+// sfx <path>
+// call <public function name>
+// skip <public function name> (runs when the timeline is skipped)
+// call & skip look functions up in the mod loader's public function list, so builds without RETRO_USE_MOD_LOADER reject them
+// skippable (lets the player skip to the end by pressing start, uses SKIPTYPE_TIMELINE so it's Plus only like other cutscene skips)
+bool32 CutsceneSeq_CompileTimeline(CutsceneTimeline *timeline, const char *script);
+// Like StartSequence, but runs 'timeline' instead of a list of states, 'actors' are the entities lerp steps move
+void CutsceneSeq_StartTimeline(void *manager, CutsceneTimeline *timeline, Entity **actors, int32 actorCount);
+// Places the actor moved by lerp step 'lerpID' where it should be on 'frame'
+void CutsceneSeq_SetTimelineActorPos(EntityCutsceneSeq *seq, int32 lerpID, int32 frame);
+// Runs a frame of the timeline, returns true once every step has finished
+bool32 CutsceneSeq_RunTimeline(EntityCutsceneSeq *seq);
+// Jumps the timeline to 'frame', actors are placed where they'd be and any sfx/callbacks at or before 'frame' are skipped
+void CutsceneSeq_SeekTimeline(EntityCutsceneSeq *seq, int32 frame);
+// Jumps to the end of the timeline & runs its skip callback, which is in charge of anything the skipped sfx/callbacks would've done
+void CutsceneSeq_SkipTimeline(EntityCutsceneSeq *seq);
+
 #endif //! OBJ_CUTSCENESEQ_H
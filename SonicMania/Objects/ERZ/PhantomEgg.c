@@ -259,8 +259,8 @@ void PhantomEgg_SetupWarpFX(void)
         PhantomEgg->startScanline = ScreenInfo->center.y;
         PhantomEgg->endScanline   = ScreenInfo->size.y;
 
-        RSDK.GetTileLayer(Zone->fgLayer[0])->scanlineCallback = PhantomEgg_Scanline_WarpFX;
-        RSDK.GetTileLayer(Zone->fgLayer[1])->scanlineCallback = PhantomEgg_Scanline_WarpFX;
+        Zone->fgTileLayer[0]->scanlineCallback = PhantomEgg_Scanline_WarpFX;
+        Zone->fgTileLayer[1]->scanlineCallback = PhantomEgg_Scanline_WarpFX;
 
         PhantomRuby_PlaySfx(RUBYSFX_ATTACK1);
 
@@ -421,7 +421,7 @@ void PhantomEgg_HandleReturnWarp(void)
 
 void PhantomEgg_Scanline_WarpFX(ScanlineInfo *scanlines)
 {
-    TileLayer *fgLow = RSDK.GetTileLayer(Zone->fgLayer[0]);
+    TileLayer *fgLow = Zone->fgTileLayer[0];
     RSDK.ProcessParallax(fgLow);
 
     int32 line = 0;
@@ -951,8 +951,8 @@ void PhantomEgg_State_Attack_WarpAway(void)
     RSDK_THIS(PhantomEgg);
 
     if (PhantomEgg->endScanline >= ScreenInfo->size.y) {
-        RSDK.GetTileLayer(Zone->fgLayer[0])->scanlineCallback = StateMachine_None;
-        RSDK.GetTileLayer(Zone->fgLayer[1])->scanlineCallback = StateMachine_None;
+        Zone->fgTileLayer[0]->scanlineCallback = StateMachine_None;
+        Zone->fgTileLayer[1]->scanlineCallback = StateMachine_None;
 
         self->timer   = 0;
         self->visible = false;
@@ -974,8 +974,8 @@ void PhantomEgg_State_Attack_WarpReturn(void)
     RSDK_THIS(PhantomEgg);
 
     if (PhantomEgg->endScanline >= ScreenInfo->size.y) {
-        RSDK.GetTileLayer(Zone->fgLayer[0])->scanlineCallback = StateMachine_None;
-        RSDK.GetTileLayer(Zone->fgLayer[1])->scanlineCallback = StateMachine_None;
+        Zone->fgTileLayer[0]->scanlineCallback = StateMachine_None;
+        Zone->fgTileLayer[1]->scanlineCallback = StateMachine_None;
 
         CREATE_ENTITY(PhantomShield, self, self->position.x, self->position.y);
         self->timer = 0;
@@ -333,7 +333,7 @@ void SpiderMobile_HandlePlatformMovement(void)
     Zone->cameraBoundsB[0] += offsetY >> 16;
     Zone->deathBoundary[0] += offsetY;
     Zone->playerBoundsB[0] += offsetY;
-    RSDK.GetTileLayer(Zone->fgLayer[1])->scrollPos -= offsetY;
+    Zone->fgTileLayer[1]->scrollPos -= offsetY;
 
     self->position.y += offsetY;
     self->origin.y += offsetY;
@@ -1117,7 +1117,7 @@ void SpiderMobile_StateBody_MovePlatformToEnd(void)
         self->visible = false;
         RSDK.PlaySfx(SpiderMobile->sfxHullClose, false, 255);
         self->state       = SpiderMobile_StateBody_FinishedMovingPlatform;
-        TileLayer *fgHigh = RSDK.GetTileLayer(Zone->fgLayer[1]);
+        TileLayer *fgHigh = Zone->fgTileLayer[1];
         fgHigh->scrollPos = 0x9200000;
         self->origin.y    = 0x13600000;
     }
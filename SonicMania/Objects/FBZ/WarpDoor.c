@@ -93,7 +93,7 @@ void WarpDoor_Update(void)
                         WarpDoor_CheckAllBounds();
 
                         if (!player->sidekick) {
-                            if (RSDK.CheckSceneFolder("TMZ2")) {
+                            if (Zone_IsSceneFolder(SCENEFOLDER_TMZ2)) {
                                 if (self->effect == TMZ2_WARPDOOR_EFFECT_MIST) {
                                     int32 sfx     = RSDK.Rand(0, 6);
                                     int32 channel = RSDK.PlaySfx(WarpDoor->sfxRubyAttackL[sfx], false, 0xFF);
@@ -113,14 +113,14 @@ void WarpDoor_Update(void)
                                         TMZ2Setup_DrawDynTiles_Ruby();
                                 }
                             }
-                            else if (RSDK.CheckSceneFolder("OOZ2")) {
+                            else if (Zone_IsSceneFolder(SCENEFOLDER_OOZ2)) {
                                 if (self->effect == OOZ_WARPDOOR_EFFECT_TO_SUB || self->effect == OOZ_WARPDOOR_EFFECT_FROM_SUB) {
                                     OOZSetup->useSmogEffect = self->effect == OOZ_WARPDOOR_EFFECT_FROM_SUB ? 1 : 0;
                                     destroyEntity(self);
                                     foreach_return;
                                 }
                             }
-                            else if (RSDK.CheckSceneFolder("FBZ")) {
+                            else if (Zone_IsSceneFolder(SCENEFOLDER_FBZ)) {
                                 RSDK.PlaySfx(WarpDoor->sfxWarpDoor, false, 0xFF);
                                 warped = false;
                                 if (self->go) {
@@ -185,7 +185,7 @@ void WarpDoor_Draw(void)
         WarpDoor_DrawDebug();
 
     if (self->fadeTimer > 0) {
-        if (RSDK.CheckSceneFolder("FBZ")) {
+        if (Zone_IsSceneFolder(SCENEFOLDER_FBZ)) {
             if (self->fadeOut)
                 RSDK.FillScreen(0x000000, self->fadeTimer, self->fadeTimer - 128, self->fadeTimer - 256);
             else
@@ -49,8 +49,18 @@ void WaterfallSound_Create(void *data)
 
 void WaterfallSound_StageLoad(void)
 {
-    if (globals->gameMode != MODE_COMPETITION)
-        Soundboard_LoadSfx("Stage/WaterfallLoop.wav", 2820, WaterfallSound_SfxCheck_WaterfallLoop, WaterfallSound_SfxUpdate_WaterfallLoop);
+    if (globals->gameMode != MODE_COMPETITION) {
+        WaterfallSound->sfxWaterfallLoop =
+            Soundboard_LoadSfx("Stage/WaterfallLoop.wav", 2820, WaterfallSound_SfxCheck_WaterfallLoop, WaterfallSound_SfxUpdate_WaterfallLoop);
+
+        foreach_all(WaterfallSound, sound)
+        {
+            Vector2 size;
+            size.x = sound->size.x >> 12;
+            size.y = sound->size.y >> 12;
+            Soundboard_AddEmitter(WaterfallSound->sfxWaterfallLoop, sound, SOUNDBOARD_EMITTER_BOX, 640, &size);
+        }
+    }
 }
 
 bool32 WaterfallSound_SfxCheck_WaterfallLoop(void)
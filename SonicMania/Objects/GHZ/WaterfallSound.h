@@ -12,6 +12,7 @@ struct ObjectWaterfallSound {
     int32 unused2;
     int32 unused3;
     uint16 aniFrames;
+    uint8 sfxWaterfallLoop;
 };
 
 // Entity Class
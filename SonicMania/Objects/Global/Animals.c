@@ -111,10 +111,10 @@ void Animals_StageLoad(void)
 {
     Animals->aniFrames = RSDK.LoadSpriteAnimation("Global/Animals.bin", SCOPE_STAGE);
 
-    if (RSDK.FindObject("Platform"))
+    if (Platform)
         Animals->hasPlatform = true;
 
-    if (RSDK.FindObject("Bridge"))
+    if (Bridge)
         Animals->hasBridge = true;
 }
 
@@ -165,7 +165,7 @@ bool32 Animals_CheckPlatformCollision(void *p)
         else if (platform->collision == PLATFORM_C_TILED
                  && RSDK.CheckObjectCollisionTouchBox(platform, &platform->hitbox, self, &self->hitboxAnimal)) {
             if (self->collisionLayers & Zone->moveLayerMask) {
-                TileLayer *move  = RSDK.GetTileLayer(Zone->moveLayer);
+                TileLayer *move  = Zone->moveTileLayer;
                 move->position.x = -(platform->drawPos.x + platform->tileOrigin.x) >> 16;
                 move->position.y = -(platform->drawPos.y + platform->tileOrigin.y) >> 16;
             }
@@ -155,50 +155,56 @@ void Camera_HandleHBounds(void)
     RSDK_THIS(Camera);
 
     RSDKScreenInfo *screen = &ScreenInfo[self->screenID];
+    int32 zoneBoundsL      = Zone->cameraBoundsL[self->screenID];
+    int32 zoneBoundsR      = Zone->cameraBoundsR[self->screenID];
+
+    // the bounds only need to move while they're catching up to a zone bounds change, which is rare
+    if (self->boundsL != zoneBoundsL || self->boundsR != zoneBoundsR) {
+        if (zoneBoundsL > self->boundsL) {
+            if (screen->position.x > zoneBoundsL)
+                self->boundsL = zoneBoundsL;
+            else
+                self->boundsL = screen->position.x;
+        }
 
-    if (Zone->cameraBoundsL[self->screenID] > self->boundsL) {
-        if (screen->position.x > Zone->cameraBoundsL[self->screenID])
-            self->boundsL = Zone->cameraBoundsL[self->screenID];
-        else
-            self->boundsL = screen->position.x;
-    }
-
-    if (Zone->cameraBoundsL[self->screenID] < self->boundsL) {
-        if (screen->position.x <= self->boundsL) {
-            int32 off     = self->boundsL - self->boundsOffset.x;
-            self->boundsL = off;
-            if (self->velocity.x < 0) {
-                self->boundsL += FROM_FIXED(self->velocity.x);
-                if (self->boundsL < Zone->cameraBoundsL[self->screenID])
-                    self->boundsL = Zone->cameraBoundsL[self->screenID];
+        if (zoneBoundsL < self->boundsL) {
+            if (screen->position.x <= self->boundsL) {
+                int32 off     = self->boundsL - self->boundsOffset.x;
+                self->boundsL = off;
+                if (self->velocity.x < 0) {
+                    self->boundsL += FROM_FIXED(self->velocity.x);
+                    if (self->boundsL < zoneBoundsL)
+                        self->boundsL = zoneBoundsL;
+                }
+            }
+            else {
+                self->boundsL = zoneBoundsL;
             }
         }
-        else {
-            self->boundsL = Zone->cameraBoundsL[self->screenID];
-        }
-    }
 
-    if (Zone->cameraBoundsR[self->screenID] < self->boundsR) {
-        if (screen->size.x + screen->position.x < Zone->cameraBoundsR[self->screenID])
-            self->boundsR = Zone->cameraBoundsR[self->screenID];
-        else
-            self->boundsR = screen->size.x + screen->position.x;
-    }
+        if (zoneBoundsR < self->boundsR) {
+            if (screen->size.x + screen->position.x < zoneBoundsR)
+                self->boundsR = zoneBoundsR;
+            else
+                self->boundsR = screen->size.x + screen->position.x;
+        }
 
-    if (Zone->cameraBoundsR[self->screenID] > self->boundsR) {
-        if (screen->size.x + screen->position.x >= self->boundsR) {
-            self->boundsR += self->boundsOffset.x;
-            if (self->velocity.x > 0) {
-                self->boundsR = FROM_FIXED(self->velocity.x) + self->boundsR;
-                if (self->boundsR > Zone->cameraBoundsR[self->screenID])
-                    self->boundsR = Zone->cameraBoundsR[self->screenID];
+        if (zoneBoundsR > self->boundsR) {
+            if (screen->size.x + screen->position.x >= self->boundsR) {
+                self->boundsR += self->boundsOffset.x;
+                if (self->velocity.x > 0) {
+                    self->boundsR = FROM_FIXED(self->velocity.x) + self->boundsR;
+                    if (self->boundsR > zoneBoundsR)
+                        self->boundsR = zoneBoundsR;
+                }
+            }
+            else {
+                self->boundsR = zoneBoundsR;
             }
-        }
-        else {
-            self->boundsR = Zone->cameraBoundsR[self->screenID];
         }
     }
 
+    // always written back, plenty of objects write to the player bounds directly & expect the camera to restore them
     Zone->playerBoundsL[self->screenID] = self->boundsL << 16;
     Zone->playerBoundsR[self->screenID] = self->boundsR << 16;
 }
@@ -207,48 +213,52 @@ void Camera_HandleVBounds(void)
     RSDK_THIS(Camera);
 
     RSDKScreenInfo *screen = &ScreenInfo[self->screenID];
+    int32 zoneBoundsT      = Zone->cameraBoundsT[self->screenID];
+    int32 zoneBoundsB      = Zone->cameraBoundsB[self->screenID];
+
+    if (self->boundsT != zoneBoundsT || self->boundsB != zoneBoundsB) {
+        if (zoneBoundsT > self->boundsT) {
+            if (screen->position.y <= self->boundsT)
+                self->boundsT = screen->position.y + self->boundsOffset.y;
+            else
+                self->boundsT = screen->position.y;
+        }
 
-    if (Zone->cameraBoundsT[self->screenID] > self->boundsT) {
-        if (screen->position.y <= self->boundsT)
-            self->boundsT = screen->position.y + self->boundsOffset.y;
-        else
-            self->boundsT = screen->position.y;
-    }
-
-    if (Zone->cameraBoundsT[self->screenID] < self->boundsT) {
-        if (screen->position.y <= self->boundsT) {
-            self->boundsT = self->boundsT - self->boundsOffset.y;
+        if (zoneBoundsT < self->boundsT) {
+            if (screen->position.y <= self->boundsT) {
+                self->boundsT = self->boundsT - self->boundsOffset.y;
 
-            if (self->velocity.y < 0) {
-                self->boundsT += FROM_FIXED(self->velocity.y);
-                if (self->boundsT < Zone->cameraBoundsT[self->screenID])
-                    self->boundsT = Zone->cameraBoundsT[self->screenID];
+                if (self->velocity.y < 0) {
+                    self->boundsT += FROM_FIXED(self->velocity.y);
+                    if (self->boundsT < zoneBoundsT)
+                        self->boundsT = zoneBoundsT;
+                }
+            }
+            else {
+                self->boundsT = zoneBoundsT;
             }
         }
-        else {
-            self->boundsT = Zone->cameraBoundsT[self->screenID];
-        }
-    }
 
-    if (Zone->cameraBoundsB[self->screenID] < self->boundsB) {
-        if (screen->size.y + screen->position.y >= self->boundsB)
-            self->boundsB -= 2;
-        else
-            self->boundsB = screen->size.y + screen->position.y;
-    }
+        if (zoneBoundsB < self->boundsB) {
+            if (screen->size.y + screen->position.y >= self->boundsB)
+                self->boundsB -= 2;
+            else
+                self->boundsB = screen->size.y + screen->position.y;
+        }
 
-    if (Zone->cameraBoundsB[self->screenID] > self->boundsB) {
-        if (screen->size.y + screen->position.y >= self->boundsB) {
-            self->boundsB += self->boundsOffset.y;
+        if (zoneBoundsB > self->boundsB) {
+            if (screen->size.y + screen->position.y >= self->boundsB) {
+                self->boundsB += self->boundsOffset.y;
 
-            if (self->velocity.y > 0) {
-                self->boundsB += FROM_FIXED(self->velocity.y);
-                if (self->boundsB > Zone->cameraBoundsB[self->screenID])
-                    self->boundsB = Zone->cameraBoundsB[self->screenID];
+                if (self->velocity.y > 0) {
+                    self->boundsB += FROM_FIXED(self->velocity.y);
+                    if (self->boundsB > zoneBoundsB)
+                        self->boundsB = zoneBoundsB;
+                }
+            }
+            else {
+                self->boundsB = zoneBoundsB;
             }
-        }
-        else {
-            self->boundsB = Zone->cameraBoundsB[self->screenID];
         }
     }
 
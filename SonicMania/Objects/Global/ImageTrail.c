@@ -48,23 +48,17 @@ void ImageTrail_LateUpdate(void)
         return;
 
     // Update recordings
-    for (int32 i = IMAGETRAIL_TRACK_COUNT - 1; i > 0; --i) {
-        self->statePos[i].x     = self->statePos[i - 1].x;
-        self->statePos[i].y     = self->statePos[i - 1].y;
-        self->stateRotation[i]  = self->stateRotation[i - 1];
-        self->stateScale[i]     = self->stateScale[i - 1];
-        self->stateDirection[i] = self->stateDirection[i - 1];
-        self->stateVisible[i]   = self->stateVisible[i - 1];
-        memcpy(&self->stateAnimator[i], &self->stateAnimator[i - 1], sizeof(Animator));
-    }
-
-    self->statePos[0].x     = self->currentPos.x;
-    self->statePos[0].y     = self->currentPos.y;
-    self->stateRotation[0]  = self->currentRotation;
-    self->stateDirection[0] = self->currentDirection;
-    self->stateScale[0]     = self->currentScale;
-    self->stateVisible[0]   = self->currentVisible;
-    memcpy(&self->stateAnimator[0], &self->currentAnimator, sizeof(Animator));
+    // step back a slot instead of shifting everything along, the oldest recording gets overwritten
+    self->stateHead = (self->stateHead + IMAGETRAIL_TRACK_COUNT - 1) % IMAGETRAIL_TRACK_COUNT;
+
+    int32 head                 = self->stateHead;
+    self->statePos[head].x     = self->currentPos.x;
+    self->statePos[head].y     = self->currentPos.y;
+    self->stateRotation[head]  = self->currentRotation;
+    self->stateDirection[head] = self->currentDirection;
+    self->stateScale[head]     = self->currentScale;
+    self->stateVisible[head]   = self->currentVisible;
+    memcpy(&self->stateAnimator[head], &self->currentAnimator, sizeof(Animator));
 
     // Record Player
     self->drawGroup        = player->drawGroup - 1;
@@ -96,7 +90,7 @@ void ImageTrail_Draw(void)
     int32 inc   = 0x40 / (IMAGETRAIL_TRACK_COUNT / 3);
 
     for (int32 i = (IMAGETRAIL_TRACK_COUNT / 3); i >= 0; --i) {
-        int32 id = (i * 3) - (i - 1);
+        int32 id = IMAGETRAIL_STATE_ID(self, (i * 3) - (i - 1));
         if (self->stateVisible[id]) {
             if (self->stateScale[id] != 0x200) {
                 self->drawFX |= FX_SCALE;
@@ -6,6 +6,9 @@
 // Constants
 #define IMAGETRAIL_TRACK_COUNT (7)
 
+// the state arrays are ring buffers, this gets the slot recorded 'framesAgo' updates back (0 being the newest)
+#define IMAGETRAIL_STATE_ID(trail, framesAgo) (((trail)->stateHead + (framesAgo)) % IMAGETRAIL_TRACK_COUNT)
+
 // Object Class
 struct ObjectImageTrail {
     RSDK_OBJECT
@@ -30,6 +33,7 @@ struct EntityImageTrail {
     Animator stateAnimator[IMAGETRAIL_TRACK_COUNT];
     int32 baseAlpha;
     int32 fadeoutTimer;
+    int32 stateHead;
 };
 
 // Object Struct
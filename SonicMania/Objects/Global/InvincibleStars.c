@@ -18,23 +18,22 @@ void InvincibleStars_Update(void)
         self->starFrame[0] = (self->starAngle[0] + 1) % 12;
         self->starFrame[1] = (self->starAngle[1] + 1) % 10;
 
-        for (int32 i = 8 - 1; i > 0; --i) {
-            self->starPos[i].x = self->starPos[i - 1].x;
-            self->starPos[i].y = self->starPos[i - 1].y;
-        }
-        self->starPos[0].x = player->position.x;
-        self->starPos[0].y = player->position.y;
+        // step back a slot instead of shifting everything along, the oldest position gets overwritten
+        self->starPosID  = (self->starPosID - 1) & 7;
+        Vector2 *starPos = INVINCIBLESTARS_STARPOS(self, 0);
+        starPos->x       = player->position.x;
+        starPos->y       = player->position.y;
 
         Hitbox *playerHitbox = Player_GetHitbox(player);
         if (player->direction & FLIP_X)
-            self->starPos[0].x += (playerHitbox->left << 15) - (playerHitbox->right << 15) - (playerHitbox->left << 16);
+            starPos->x += (playerHitbox->left << 15) - (playerHitbox->right << 15) - (playerHitbox->left << 16);
         else
-            self->starPos[0].x += ((playerHitbox->right + 2 * playerHitbox->left) << 15) - (playerHitbox->left << 15);
+            starPos->x += ((playerHitbox->right + 2 * playerHitbox->left) << 15) - (playerHitbox->left << 15);
 
         if ((player->direction & FLIP_Y) && !player->invertGravity)
-            self->starPos[0].y += (playerHitbox->top << 15) - (playerHitbox->bottom << 15) - (playerHitbox->top << 16);
+            starPos->y += (playerHitbox->top << 15) - (playerHitbox->bottom << 15) - (playerHitbox->top << 16);
         else
-            self->starPos[0].y += ((playerHitbox->bottom + 2 * playerHitbox->top) << 15) - (playerHitbox->top << 15);
+            starPos->y += ((playerHitbox->bottom + 2 * playerHitbox->top) << 15) - (playerHitbox->top << 15);
 
         if (player->direction) {
             self->starAngle[0] -= 144;
@@ -85,44 +84,49 @@ void InvincibleStars_Draw(void)
         }
     }
 
+    Vector2 *pos7 = INVINCIBLESTARS_STARPOS(self, 7);
+    Vector2 *pos5 = INVINCIBLESTARS_STARPOS(self, 5);
+    Vector2 *pos3 = INVINCIBLESTARS_STARPOS(self, 3);
+    Vector2 *pos0 = INVINCIBLESTARS_STARPOS(self, 0);
+
     Vector2 drawPos;
-    drawPos.x                     = (RSDK.Cos512(self->starAngle[1] + 0x74) << self->starOffset) + self->starPos[7].x;
-    drawPos.y                     = (RSDK.Sin512(self->starAngle[1] + 0x74) << self->starOffset) + self->starPos[7].y;
+    drawPos.x                     = (RSDK.Cos512(self->starAngle[1] + 0x74) << self->starOffset) + pos7->x;
+    drawPos.y                     = (RSDK.Sin512(self->starAngle[1] + 0x74) << self->starOffset) + pos7->y;
     self->starAnimator[3].frameID = self->starFrame[0];
     RSDK.DrawSprite(&self->starAnimator[3], &drawPos, false);
 
-    drawPos.x = (RSDK.Cos512(self->starAngle[1] + 0x174) << self->starOffset) + self->starPos[7].x;
-    drawPos.y = (RSDK.Sin512(self->starAngle[1] + 0x174) << self->starOffset) + self->starPos[7].y;
+    drawPos.x = (RSDK.Cos512(self->starAngle[1] + 0x174) << self->starOffset) + pos7->x;
+    drawPos.y = (RSDK.Sin512(self->starAngle[1] + 0x174) << self->starOffset) + pos7->y;
     self->starAnimator[3].frameID += 6;
     RSDK.DrawSprite(&self->starAnimator[3], &drawPos, false);
 
-    drawPos.x                     = (RSDK.Cos512(self->starAngle[1]) << self->starOffset) + self->starPos[5].x;
-    drawPos.y                     = (RSDK.Sin512(self->starAngle[1]) << self->starOffset) + self->starPos[5].y;
+    drawPos.x                     = (RSDK.Cos512(self->starAngle[1]) << self->starOffset) + pos5->x;
+    drawPos.y                     = (RSDK.Sin512(self->starAngle[1]) << self->starOffset) + pos5->y;
     self->starAnimator[2].frameID = self->starFrame[0];
     RSDK.DrawSprite(&self->starAnimator[2], &drawPos, false);
 
-    drawPos.x = (RSDK.Cos512(self->starAngle[1] + 0x100) << self->starOffset) + self->starPos[5].x;
-    drawPos.y = (RSDK.Sin512(self->starAngle[1] + 0x100) << self->starOffset) + self->starPos[5].y;
+    drawPos.x = (RSDK.Cos512(self->starAngle[1] + 0x100) << self->starOffset) + pos5->x;
+    drawPos.y = (RSDK.Sin512(self->starAngle[1] + 0x100) << self->starOffset) + pos5->y;
     self->starAnimator[2].frameID += 6;
     RSDK.DrawSprite(&self->starAnimator[2], &drawPos, false);
 
-    drawPos.x                     = (RSDK.Cos512(self->starAngle[1] + 0xA8) << self->starOffset) + self->starPos[3].x;
-    drawPos.y                     = (RSDK.Sin512(self->starAngle[1] + 0xA8) << self->starOffset) + self->starPos[3].y;
+    drawPos.x                     = (RSDK.Cos512(self->starAngle[1] + 0xA8) << self->starOffset) + pos3->x;
+    drawPos.y                     = (RSDK.Sin512(self->starAngle[1] + 0xA8) << self->starOffset) + pos3->y;
     self->starAnimator[1].frameID = self->starFrame[1];
     RSDK.DrawSprite(&self->starAnimator[1], &drawPos, false);
 
-    drawPos.x = (RSDK.Cos512(self->starAngle[1] + 0x1A8) << self->starOffset) + self->starPos[3].x;
-    drawPos.y = (RSDK.Sin512(self->starAngle[1] + 0x1A8) << self->starOffset) + self->starPos[3].y;
+    drawPos.x = (RSDK.Cos512(self->starAngle[1] + 0x1A8) << self->starOffset) + pos3->x;
+    drawPos.y = (RSDK.Sin512(self->starAngle[1] + 0x1A8) << self->starOffset) + pos3->y;
     self->starAnimator[1].frameID += 5;
     RSDK.DrawSprite(&self->starAnimator[1], &drawPos, false);
 
-    drawPos.x                     = (RSDK.Cos512(self->starAngle[0]) << self->starOffset) + self->starPos[0].x;
-    drawPos.y                     = (RSDK.Sin512(self->starAngle[0]) << self->starOffset) + self->starPos[0].y;
+    drawPos.x                     = (RSDK.Cos512(self->starAngle[0]) << self->starOffset) + pos0->x;
+    drawPos.y                     = (RSDK.Sin512(self->starAngle[0]) << self->starOffset) + pos0->y;
     self->starAnimator[0].frameID = self->starFrame[0];
     RSDK.DrawSprite(&self->starAnimator[0], &drawPos, false);
 
-    drawPos.x = (RSDK.Cos512(self->starAngle[0] + 0x100) << self->starOffset) + self->starPos[0].x;
-    drawPos.y = (RSDK.Sin512(self->starAngle[0] + 0x100) << self->starOffset) + self->starPos[0].y;
+    drawPos.x = (RSDK.Cos512(self->starAngle[0] + 0x100) << self->starOffset) + pos0->x;
+    drawPos.y = (RSDK.Sin512(self->starAngle[0] + 0x100) << self->starOffset) + pos0->y;
     RSDK.DrawSprite(&self->starAnimator[0], &drawPos, false);
 }
 
@@ -3,6 +3,9 @@
 
 #include "Game.h"
 
+// starPos is a ring buffer, this gets the position from 'framesAgo' updates back (0 being the newest)
+#define INVINCIBLESTARS_STARPOS(stars, framesAgo) (&(stars)->starPos[((stars)->starPosID + (framesAgo)) & 7])
+
 // Object Class
 struct ObjectInvincibleStars {
     RSDK_OBJECT
@@ -18,6 +21,7 @@ struct EntityInvincibleStars {
     int32 starFrame[2];
     int32 starOffset;
     Animator starAnimator[4];
+    int32 starPosID;
 };
 
 // Object Struct
@@ -316,8 +316,8 @@ void ItemBox_State_Idle(void)
         RSDK.ProcessAnimation(&self->debrisAnimator);
 
         if (!self->debrisAnimator.frameID) {
-            self->timer                        = RSDK.Rand(1, 15);
-            self->debrisAnimator.frameDuration = RSDK.Rand(1, 32);
+            self->timer                        = COSMETIC_RAND(1, 15);
+            self->debrisAnimator.frameDuration = COSMETIC_RAND(1, 32);
         }
     }
 }
@@ -353,8 +353,8 @@ void ItemBox_State_Falling(void)
         RSDK.ProcessAnimation(&self->debrisAnimator);
 
         if (!self->debrisAnimator.frameID) {
-            self->timer                        = RSDK.Rand(1, 15);
-            self->debrisAnimator.frameDuration = RSDK.Rand(1, 32);
+            self->timer                        = COSMETIC_RAND(1, 15);
+            self->debrisAnimator.frameDuration = COSMETIC_RAND(1, 32);
         }
     }
 }
@@ -389,8 +389,8 @@ void ItemBox_State_Conveyor(void)
         RSDK.ProcessAnimation(&self->debrisAnimator);
 
         if (!self->debrisAnimator.frameID) {
-            self->timer                        = RSDK.Rand(1, 15);
-            self->debrisAnimator.frameDuration = RSDK.Rand(1, 32);
+            self->timer                        = COSMETIC_RAND(1, 15);
+            self->debrisAnimator.frameDuration = COSMETIC_RAND(1, 32);
         }
     }
 }
@@ -828,18 +828,18 @@ void ItemBox_Break(EntityItemBox *itemBox, EntityPlayer *player)
     explosion->drawGroup       = Zone->objectDrawGroup[1];
 
     for (int32 d = 0; d < 6; ++d) {
-        EntityDebris *debris    = CREATE_ENTITY(Debris, NULL, itemBox->position.x + RSDK.Rand(-0x80000, 0x80000),
-                                             itemBox->position.y + RSDK.Rand(-TO_FIXED(8), TO_FIXED(8)));
+        EntityDebris *debris    = CREATE_ENTITY(Debris, NULL, itemBox->position.x + COSMETIC_RAND(-0x80000, 0x80000),
+                                             itemBox->position.y + COSMETIC_RAND(-TO_FIXED(8), TO_FIXED(8)));
         debris->state           = Debris_State_Fall;
         debris->gravityStrength = 0x4000;
-        debris->velocity.x      = RSDK.Rand(0, TO_FIXED(2));
+        debris->velocity.x      = COSMETIC_RAND(0, TO_FIXED(2));
         if (debris->position.x < itemBox->position.x)
             debris->velocity.x = -debris->velocity.x;
-        debris->velocity.y = RSDK.Rand(-TO_FIXED(4), -TO_FIXED(1));
+        debris->velocity.y = COSMETIC_RAND(-TO_FIXED(4), -TO_FIXED(1));
         debris->drawFX     = FX_FLIP;
         debris->direction  = d & 3;
         debris->drawGroup  = Zone->objectDrawGroup[1];
-        RSDK.SetSpriteAnimation(ItemBox->aniFrames, 6, &debris->animator, true, RSDK.Rand(0, 4));
+        RSDK.SetSpriteAnimation(ItemBox->aniFrames, 6, &debris->animator, true, COSMETIC_RAND(0, 4));
     }
 
     RSDK.PlaySfx(ItemBox->sfxDestroy, false, 255);
@@ -956,7 +956,7 @@ bool32 ItemBox_HandlePlatformCollision(void *plat)
                     break;
 
                 if (self->collisionLayers & Zone->moveLayerMask) {
-                    TileLayer *move  = RSDK.GetTileLayer(Zone->moveLayer);
+                    TileLayer *move  = Zone->moveTileLayer;
                     move->position.x = -(platform->drawPos.x + platform->tileOrigin.x) >> 16;
                     move->position.y = -(platform->drawPos.y + platform->tileOrigin.y) >> 16;
                 }
@@ -41,6 +41,8 @@ void PlaneSwitch_Create(void *data)
         self->visible       = false;
         self->drawGroup     = Zone->objectDrawGroup[0];
         self->negAngle      = -self->angle & 0xFF;
+        self->negSine       = RSDK.Sin256(self->negAngle);
+        self->negCosine     = RSDK.Cos256(self->negAngle);
     }
 }
 
@@ -82,11 +84,23 @@ void PlaneSwitch_CheckCollisions(EntityPlaneSwitch *self, void *o, int32 flags,
 {
     Entity *other = (Entity *)o;
 
-    Vector2 pivotPos = other->position;
-    Vector2 pivotVel = other->velocity;
+    // the switch's bounds can't reach further than this on either axis no matter the angle, so skip rotating anything outside of it
+    int32 reach = (TO_FIXED(24) + (size << 19)) << 1;
+    if (abs(other->position.x - self->position.x) > reach || abs(other->position.y - self->position.y) > reach)
+        return;
 
-    Zone_RotateOnPivot(&pivotPos, &self->position, self->negAngle);
-    Zone_RotateOnPivot(&pivotVel, &self->velocity, self->negAngle);
+    // same as Zone_RotateOnPivot, but using the sine & cosine cached in Create
+    int32 x          = (other->position.x - self->position.x) >> 8;
+    int32 y          = (other->position.y - self->position.y) >> 8;
+    Vector2 pivotPos = self->position;
+    pivotPos.x += y * self->negSine + x * self->negCosine;
+    pivotPos.y += y * self->negCosine - x * self->negSine;
+
+    x                = (other->velocity.x - self->velocity.x) >> 8;
+    y                = (other->velocity.y - self->velocity.y) >> 8;
+    Vector2 pivotVel = self->velocity;
+    pivotVel.x += y * self->negSine + x * self->negCosine;
+    pivotVel.y += y * self->negCosine - x * self->negSine;
 
     if (!self->onPath || other->onGround) {
         if (abs(pivotPos.x - self->position.x) < TO_FIXED(24) && abs(pivotPos.y - self->position.y) < size << 19) {
@@ -127,6 +141,8 @@ void PlaneSwitch_EditorDraw(void)
     self->visible       = false;
     self->drawGroup     = Zone->objectDrawGroup[0];
     self->negAngle      = -self->angle & 0xFF;
+    self->negSine       = RSDK.Sin256(self->negAngle);
+    self->negCosine     = RSDK.Cos256(self->negAngle);
 
     PlaneSwitch_DrawSprites();
 }
@@ -28,6 +28,8 @@ struct EntityPlaneSwitch {
     bool32 onPath;
     int32 negAngle;
     Animator animator;
+    int32 negSine;
+    int32 negCosine;
 };
 
 // Object Struct
@@ -113,7 +113,7 @@ void Player_Update(void)
         self->collisionFlagH = 0;
         self->collisionFlagV = 0;
         if (self->collisionLayers & Zone->moveLayerMask) {
-            TileLayer *move  = RSDK.GetTileLayer(Zone->moveLayer);
+            TileLayer *move  = Zone->moveTileLayer;
             move->position.x = -self->moveLayerPosition.x >> 16;
             move->position.y = -self->moveLayerPosition.y >> 16;
         }
@@ -168,7 +168,7 @@ void Player_LateUpdate(void)
 
 #if MANIA_USE_PLUS
         if (!self->sidekick)
-            RSDK.CopyEntity(&Zone->entityStorage[1], self, false);
+            RSDK.CopyEntity(&Zone->entityStorage[ZONE_STORAGE_PLAYER(1)], self, false);
 #endif
 
         bool32 stopInvincibility = self->sidekick || globals->gameMode == MODE_COMPETITION;
@@ -727,18 +727,15 @@ void Player_StageLoad(void)
 #endif
 
     // Handle Sidekick stuff setup
-    Player->nextLeaderPosID = 1;
     Player->lastLeaderPosID = 0;
 #if GAME_VERSION != VER_100
     Player->disableP2KeyCheck = false;
 #endif
 
-    Player->upState        = false;
-    Player->downState      = false;
-    Player->leftState      = false;
-    Player->rightState     = false;
-    Player->jumpPressState = false;
-    Player->jumpHoldState  = false;
+    // each extra follower trails the one before it by the same amount P2 always has
+    for (int32 f = 0; f < PLAYER_FOLLOWER_COUNT; ++f) Player->followerDelays[f] = 15 * (f + 1);
+
+    Player_ResetLeaderInputs();
 
     // Sfx Loading
     Player->sfxJump        = RSDK.GetSfx("Global/Jump.wav");
@@ -821,7 +818,7 @@ void Player_LoadSprites(void)
         EntityPlayer *leader   = RSDK_GET_ENTITY(SLOT_PLAYER1, Player);
         EntityPlayer *sidekick = RSDK_GET_ENTITY(SLOT_PLAYER2, Player);
 
-        for (int32 i = 0; i < 0x10; ++i) Player->leaderPositionBuffer[i] = leader->position;
+        Player_ResetLeaderPositions(&leader->position);
 
         sidekick->classID    = Player->classID;
         sidekick->position.x = leader->position.x;
@@ -3410,9 +3407,9 @@ bool32 Player_SwapMainPlayer(bool32 forceSwap)
                 destroyEntity(ice);
         }
     }
-    RSDK.CopyEntity(&Zone->entityStorage[0], leader, false);
+    RSDK.CopyEntity(&Zone->entityStorage[ZONE_STORAGE_PLAYER(0)], leader, false);
     RSDK.CopyEntity(leader, sidekick, false);
-    RSDK.CopyEntity(sidekick, &Zone->entityStorage[0], false);
+    RSDK.CopyEntity(sidekick, &Zone->entityStorage[ZONE_STORAGE_PLAYER(0)], false);
 
     sidekick->state       = Player_State_Air;
     self->controllerID    = sidekick->controllerID;
@@ -3675,7 +3672,7 @@ void Player_HandleFlyCarry(EntityPlayer *leader)
         Hitbox *sidekickOuterBox = RSDK.GetHitbox(&self->animator, 0);
         Hitbox *sidekickInnerBox = RSDK.GetHitbox(&self->animator, 1);
         if (self->collisionLayers & Zone->moveLayerMask) {
-            TileLayer *move  = RSDK.GetTileLayer(Zone->moveLayer);
+            TileLayer *move  = Zone->moveTileLayer;
             move->position.x = -self->moveLayerPosition.x >> 16;
             move->position.y = -self->moveLayerPosition.y >> 16;
         }
@@ -3701,7 +3698,7 @@ void Player_HandleFlyCarry(EntityPlayer *leader)
         Hitbox *leaderOuterBox = Player_GetHitbox(leader);
         Hitbox *leaderInnerBox = Player_GetAltHitbox(leader);
         if (leader->collisionLayers & Zone->moveLayerMask) {
-            TileLayer *move  = RSDK.GetTileLayer(Zone->moveLayer);
+            TileLayer *move  = Zone->moveTileLayer;
             move->position.x = -leader->moveLayerPosition.x >> 16;
             move->position.y = -leader->moveLayerPosition.y >> 16;
         }
@@ -3763,6 +3760,33 @@ void Player_HandleSidekickRespawn(void)
         }
     }
 }
+void Player_ResetLeaderInputs(void)
+{
+    Player->leaderInputs    = 0;
+    Player->inputHistoryPos = 0;
+    for (int32 i = 0; i < PLAYER_LEADERHISTORY_SIZE; ++i) Player->inputHistory[i] = 0;
+}
+void Player_ResetLeaderPositions(Vector2 *position)
+{
+    for (int32 i = 0; i < PLAYER_LEADERHISTORY_SIZE; ++i) {
+        Player->leaderPositionBuffer[i].x = position->x;
+        Player->leaderPositionBuffer[i].y = position->y;
+    }
+}
+bool32 Player_CheckLeadFollower(EntityPlayer *player)
+{
+    // the first sidekick to update each frame is the one that records the leader, the rest just read back from the history
+    for (int32 p = SLOT_PLAYER2; p < RSDK.GetEntitySlot(player); ++p) {
+        EntityPlayer *follower = RSDK_GET_ENTITY(p, Player);
+
+        if (follower->classID == Player->classID
+            && (follower->stateInput == Player_Input_P2_Delay || follower->stateInput == Player_Input_P2_AI)) {
+            return false;
+        }
+    }
+
+    return true;
+}
 void Player_State_StartSuper(void)
 {
     RSDK_THIS(Player);
@@ -5553,7 +5577,7 @@ void Player_State_FlyToPlayer(void)
         leader = RSDK_GET_ENTITY(SLOT_PLAYER1, Player);
 #if MANIA_USE_PLUS
     else
-        leader = (EntityPlayer *)&Zone->entityStorage[1];
+        leader = (EntityPlayer *)&Zone->entityStorage[ZONE_STORAGE_PLAYER(1)];
 #endif
 
     Player->respawnTimer = 0;
@@ -5722,7 +5746,7 @@ void Player_State_ReturnToPlayer(void)
         leader = RSDK_GET_ENTITY(SLOT_PLAYER1, Player);
 #if MANIA_USE_PLUS
     else
-        leader = (EntityPlayer *)&Zone->entityStorage[1];
+        leader = (EntityPlayer *)&Zone->entityStorage[ZONE_STORAGE_PLAYER(1)];
 #endif
 
     RSDK.SetSpriteAnimation(self->aniFrames, ANI_JUMP, &self->animator, false, 0);
@@ -5890,12 +5914,7 @@ void Player_FinishedReturnToPlayer(EntityPlayer *player, EntityPlayer *leader)
         EntityPlayer *plr1     = RSDK_GET_ENTITY(SLOT_PLAYER1, Player);
         player->velocity.x     = plr1->velocity.x;
         player->groundVel      = plr1->groundVel;
-        Player->upState        = 0;
-        Player->downState      = 0;
-        Player->leftState      = 0;
-        Player->rightState     = 0;
-        Player->jumpHoldState  = 0;
-        Player->jumpPressState = 0;
+        Player_ResetLeaderInputs();
     }
 
     player->collisionPlane = leader->collisionPlane;
@@ -5912,12 +5931,7 @@ void Player_FinishedReturnToPlayer(EntityPlayer *player, EntityPlayer *leader)
     }
     destroyEntity(parent);
 
-    Player->upState        = false;
-    Player->downState      = false;
-    Player->leftState      = false;
-    Player->rightState     = false;
-    Player->jumpPressState = false;
-    Player->jumpHoldState  = false;
+    Player_ResetLeaderInputs();
 
     if (BoundsMarker)
         BoundsMarker_ApplyAllBounds(player, false);
@@ -6469,63 +6483,66 @@ void Player_Input_P2_Delay(void)
     RSDK_THIS(Player);
     EntityPlayer *leader = RSDK_GET_ENTITY(SLOT_PLAYER1, Player);
 
-    Player->upState <<= 1;
-    Player->upState |= leader->up;
-    Player->upState &= 0xFFFF;
-
-    Player->downState <<= 1;
-    Player->downState |= leader->down;
-    Player->downState &= 0xFFFF;
-
-    Player->leftState <<= 1;
-    Player->leftState |= leader->left;
-    Player->leftState &= 0xFFFF;
+    int32 delay       = Player->followerDelays[CLAMP(self->playerID - 1, 0, PLAYER_FOLLOWER_COUNT - 1)];
+    bool32 isRecorder = Player_CheckLeadFollower(self);
 
-    Player->rightState <<= 1;
-    Player->rightState |= leader->right;
-    Player->rightState &= 0xFFFF;
+    if (isRecorder) {
+        uint8 inputs = 0;
+        if (leader->up)
+            inputs |= PLAYER_INPUT_UP;
+        if (leader->down)
+            inputs |= PLAYER_INPUT_DOWN;
+        if (leader->left)
+            inputs |= PLAYER_INPUT_LEFT;
+        if (leader->right)
+            inputs |= PLAYER_INPUT_RIGHT;
+        if (leader->jumpPress)
+            inputs |= PLAYER_INPUT_JUMPPRESS;
+        if (leader->jumpHold)
+            inputs |= PLAYER_INPUT_JUMPHOLD;
 
-    Player->jumpPressState <<= 1;
-    Player->jumpPressState |= leader->jumpPress;
-    Player->jumpPressState &= 0xFFFF;
+        Player->leaderInputs                          = inputs;
+        Player->inputHistoryPos                       = (Player->inputHistoryPos + 1) & (PLAYER_LEADERHISTORY_SIZE - 1);
+        Player->inputHistory[Player->inputHistoryPos] = inputs;
+    }
 
-    Player->jumpHoldState <<= 1;
-    Player->jumpHoldState |= leader->jumpHold;
-    Player->jumpHoldState &= 0xFFFF;
+    uint8 inputs = Player->inputHistory[(Player->inputHistoryPos - delay) & (PLAYER_LEADERHISTORY_SIZE - 1)];
 
     if (leader->state == Player_State_FlyCarried) {
-        Player->downState <<= 15;
-        Player->leftState <<= 15;
-        Player->rightState <<= 15;
-        Player->jumpPressState <<= 15;
-        Player->jumpHoldState <<= 15;
+        // everything but up reacts instantly while being carried, and anything held before that gets dropped
+        inputs = (inputs & PLAYER_INPUT_UP) | (Player->leaderInputs & ~PLAYER_INPUT_UP);
+
+        if (isRecorder) {
+            for (int32 i = 0; i < PLAYER_LEADERHISTORY_SIZE; ++i) Player->inputHistory[i] &= PLAYER_INPUT_UP;
+        }
     }
 
-    self->up        = Player->upState >> 15;
-    self->down      = Player->downState >> 15;
-    self->left      = Player->leftState >> 15;
-    self->right     = Player->rightState >> 15;
-    self->jumpPress = Player->jumpPressState >> 15;
-    self->jumpHold  = Player->jumpHoldState >> 15;
+    self->up        = (inputs & PLAYER_INPUT_UP) != 0;
+    self->down      = (inputs & PLAYER_INPUT_DOWN) != 0;
+    self->left      = (inputs & PLAYER_INPUT_LEFT) != 0;
+    self->right     = (inputs & PLAYER_INPUT_RIGHT) != 0;
+    self->jumpPress = (inputs & PLAYER_INPUT_JUMPPRESS) != 0;
+    self->jumpHold  = (inputs & PLAYER_INPUT_JUMPHOLD) != 0;
 
     if (Player_CheckValidState(leader)) {
-        Player->leaderPositionBuffer[Player->lastLeaderPosID].x = leader->position.x;
-        Player->leaderPositionBuffer[Player->lastLeaderPosID].y = leader->position.y;
-        Player->lastLeaderPosID                                 = (Player->lastLeaderPosID + 1) & 0xF;
-        Player->nextLeaderPosID                                 = (Player->nextLeaderPosID + 1) & 0xF;
+        if (isRecorder) {
+            Player->leaderPositionBuffer[Player->lastLeaderPosID].x = leader->position.x;
+            Player->leaderPositionBuffer[Player->lastLeaderPosID].y = leader->position.y;
+            Player->lastLeaderPosID                                 = (Player->lastLeaderPosID + 1) & (PLAYER_LEADERHISTORY_SIZE - 1);
+        }
+
         if (!leader->onGround && leader->groundedStore) {
             Player->targetLeaderPosition.x = leader->position.x;
             Player->targetLeaderPosition.y = leader->position.y;
         }
         else {
-            Player->targetLeaderPosition.x = Player->leaderPositionBuffer[Player->nextLeaderPosID].x;
-            Player->targetLeaderPosition.y = Player->leaderPositionBuffer[Player->nextLeaderPosID].y;
+            int32 pos                      = (Player->lastLeaderPosID - delay) & (PLAYER_LEADERHISTORY_SIZE - 1);
+            Player->targetLeaderPosition.x = Player->leaderPositionBuffer[pos].x;
+            Player->targetLeaderPosition.y = Player->leaderPositionBuffer[pos].y;
         }
     }
     else {
-        int32 pos = Player->lastLeaderPosID - 1;
-        if (pos < 0)
-            pos += 16;
+        int32 pos = (Player->lastLeaderPosID - 1) & (PLAYER_LEADERHISTORY_SIZE - 1);
 
         Player->targetLeaderPosition.x = Player->leaderPositionBuffer[pos].x;
         Player->targetLeaderPosition.y = Player->leaderPositionBuffer[pos].y;
@@ -16,6 +16,12 @@
 
 #define PLAYER_PRIMARY_COLOR_COUNT (6)
 
+// how many frames of leader inputs & positions are kept for sidekicks, must be a power of 2 larger than the longest follower delay
+#ifndef PLAYER_LEADERHISTORY_SIZE
+#define PLAYER_LEADERHISTORY_SIZE (0x40)
+#endif
+#define PLAYER_FOLLOWER_COUNT (4)
+
 // Helper Enums
 typedef enum {
     ANI_IDLE,
@@ -153,6 +159,15 @@ typedef enum {
     SUPERSTATE_DONE,
 } SuperStates;
 
+typedef enum {
+    PLAYER_INPUT_UP        = 1 << 0,
+    PLAYER_INPUT_DOWN      = 1 << 1,
+    PLAYER_INPUT_LEFT      = 1 << 2,
+    PLAYER_INPUT_RIGHT     = 1 << 3,
+    PLAYER_INPUT_JUMPPRESS = 1 << 4,
+    PLAYER_INPUT_JUMPHOLD  = 1 << 5,
+} PlayerInputFlags;
+
 // Object Class
 #if MANIA_USE_PLUS
 struct ObjectPlayer {
@@ -214,15 +229,9 @@ struct ObjectPlayer {
                                             0xE080D8, 0xE080E0, 0xE02880, 0xE05888, 0xE08088, 0xE080A8, 0xE080D8, 0xE080E0 });
     bool32 cantSwap;
     int32 playerCount;
-    uint16 upState;
-    uint16 downState;
-    uint16 leftState;
-    uint16 rightState;
-    uint16 jumpPressState;
-    uint16 jumpHoldState;
-    int32 nextLeaderPosID;
-    int32 lastLeaderPosID;
-    Vector2 leaderPositionBuffer[16];
+    // used to be the per-button input shift registers & a 16 entry leader buffer, the sidekick history now lives at the end of the struct
+    // this is kept the same size so the static var offsets after it still line up
+    uint8 unusedLeaderHistory[0x94];
     Vector2 targetLeaderPosition;
     int32 autoJumpTimer;
     int32 respawnTimer;
@@ -273,6 +282,12 @@ struct ObjectPlayer {
     StateMachine(configureGhostCB);
     bool32 (*canSuperCB)(bool32 isHUD);
     int32 superDashCooldown;
+    uint8 leaderInputs;
+    int32 inputHistoryPos;
+    uint8 inputHistory[PLAYER_LEADERHISTORY_SIZE];
+    int32 lastLeaderPosID;
+    Vector2 leaderPositionBuffer[PLAYER_LEADERHISTORY_SIZE];
+    int32 followerDelays[PLAYER_FOLLOWER_COUNT];
 };
 #else
 struct ObjectPlayer {
@@ -293,15 +308,9 @@ struct ObjectPlayer {
             0xA0000, 0x3000, 0x6000, 0x1800, 0x10000, 0x600, 0x60000, -0x40000, 0x50000, 0x1800, 0x3000, 0xC00, 0x8000, 0x300, 0x30000, -0x20000,
             0xC0000, 0x1800, 0x3000, 0xC00,  0x8000,  0x600, 0x60000, -0x40000, 0x60000, 0xC00,  0x1800, 0x600, 0x4000, 0x300, 0x30000, -0x20000,
             0xC0000, 0x1800, 0x3000, 0xC00,  0x8000,  0x600, 0x60000, -0x40000, 0x60000, 0xC00,  0x1800, 0x600, 0x8000, 0x300, 0x30000, -0x20000 });
-    uint16 upState;
-    uint16 downState;
-    uint16 leftState;
-    uint16 rightState;
-    uint16 jumpPressState;
-    uint16 jumpHoldState;
-    int32 nextLeaderPosID;
-    int32 lastLeaderPosID;
-    Vector2 leaderPositionBuffer[16];
+    // used to be the per-button input shift registers & a 16 entry leader buffer, the sidekick history now lives at the end of the struct
+    // this is kept the same size so the static var offsets after it still line up
+    uint8 unusedLeaderHistory[0x94];
     Vector2 targetLeaderPosition;
     int32 autoJumpTimer;
     int32 respawnTimer;
@@ -359,6 +368,12 @@ struct ObjectPlayer {
     uint16 sfxOuttahere;
     uint16 sfxTransform2;
     bool32 gotHit[PLAYER_COUNT];
+    uint8 leaderInputs;
+    int32 inputHistoryPos;
+    uint8 inputHistory[PLAYER_LEADERHISTORY_SIZE];
+    int32 lastLeaderPosID;
+    Vector2 leaderPositionBuffer[PLAYER_LEADERHISTORY_SIZE];
+    int32 followerDelays[PLAYER_FOLLOWER_COUNT];
 };
 #endif
 
@@ -573,6 +588,9 @@ void Player_Hit(EntityPlayer *player);
 bool32 Player_CheckValidState(EntityPlayer *player);
 void Player_HandleFlyCarry(EntityPlayer *leader);
 void Player_HandleSidekickRespawn(void);
+void Player_ResetLeaderInputs(void);
+void Player_ResetLeaderPositions(Vector2 *position);
+bool32 Player_CheckLeadFollower(EntityPlayer *player);
 void Player_State_StartSuper(void);
 
 // States
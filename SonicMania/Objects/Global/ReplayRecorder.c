@@ -893,9 +893,9 @@ void ReplayRecorder_SetGimmickState(EntityReplayRecorder *recorder, bool32 allow
     if (player) {
         player->tailFrames = -1;
 
-        if (RSDK.CheckSceneFolder("MMZ") || RSDK.CheckSceneFolder("PSZ2")) {
+        if (Zone_IsSceneFolder(SCENEFOLDER_MMZ | SCENEFOLDER_PSZ2)) {
             if (allowSpriteChanges) {
-                if (RSDK.CheckSceneFolder("MMZ")) {
+                if (Zone_IsSceneFolder(SCENEFOLDER_MMZ)) {
                     switch (player->characterID) {
                         default:
                         case ID_SONIC: player->aniFrames = SizeLaser->sonicFrames; break;
@@ -910,7 +910,7 @@ void ReplayRecorder_SetGimmickState(EntityReplayRecorder *recorder, bool32 allow
                         case ID_RAY: player->aniFrames = SizeLaser->rayFrames; break;
                     }
                 }
-                else if (RSDK.CheckSceneFolder("PSZ2")) {
+                else if (Zone_IsSceneFolder(SCENEFOLDER_PSZ2)) {
                     player->aniFrames = Ice->aniFrames;
                 }
             }
@@ -985,13 +985,13 @@ bool32 ReplayRecorder_CheckPlayerGimmickState(EntityReplayRecorder *recorder)
 {
     EntityPlayer *player = recorder->player;
 
-    if (!player || (!RSDK.CheckSceneFolder("MMZ") && !RSDK.CheckSceneFolder("PSZ2")))
+    if (!player || !Zone_IsSceneFolder(SCENEFOLDER_MMZ | SCENEFOLDER_PSZ2))
         return false;
 
-    if (RSDK.CheckSceneFolder("MMZ"))
+    if (Zone_IsSceneFolder(SCENEFOLDER_MMZ))
         return player->isChibi;
 
-    if (RSDK.CheckSceneFolder("PSZ2"))
+    if (Zone_IsSceneFolder(SCENEFOLDER_PSZ2))
         return player->state == Ice_PlayerState_Frozen;
 
     return false;
@@ -1281,7 +1281,7 @@ void ReplayRecorder_Late_RecordFrames(void)
         EntityIce *ice = player->abilityPtrs[1];
 
         Animator *animator = &player->animator;
-        if (isGimmickState && RSDK.CheckSceneFolder("PSZ2") && player->state == Ice_PlayerState_Frozen && ice->classID == Ice->classID)
+        if (isGimmickState && Zone_IsSceneFolder(SCENEFOLDER_PSZ2) && player->state == Ice_PlayerState_Frozen && ice->classID == Ice->classID)
             animator = &ice->contentsAnimator;
 
         self->animID  = animator->animationID;
@@ -24,7 +24,10 @@ void Ring_Draw(void)
 {
     RSDK_THIS(Ring);
 
-    StateMachine_Run(self->stateDraw);
+    // rings are drawn once per screen, so skip the ones outside of the screen we're currently drawing (mostly matters for split-screen)
+    Vector2 range = { TO_FIXED(32), TO_FIXED(32) };
+    if (Zone_CheckPosOnCurrentScreen(self->stateDraw == Ring_Draw_Oscillating ? &self->drawPos : &self->position, &range))
+        StateMachine_Run(self->stateDraw);
 }
 
 void Ring_Create(void *data)
@@ -153,8 +156,8 @@ void Ring_Collect(void)
                 int32 cnt = 4 * (self->type == RING_TYPE_BIG) + 4;
                 int32 min = -max;
                 for (int32 i = 0; i < cnt; ++i) {
-                    int32 x             = self->position.x + RSDK.Rand(min, max);
-                    int32 y             = self->position.y + RSDK.Rand(min, max);
+                    int32 x             = self->position.x + COSMETIC_RAND(min, max);
+                    int32 y             = self->position.y + COSMETIC_RAND(min, max);
                     EntityRing *sparkle = CREATE_ENTITY(Ring, NULL, x, y);
 
                     sparkle->state     = Ring_State_Sparkle;
@@ -173,7 +176,7 @@ void Ring_Collect(void)
                         frameCount >>= 1;
                     }
                     sparkle->maxFrameCount  = frameCount - 1;
-                    sparkle->animator.speed = RSDK.Rand(6, 8);
+                    sparkle->animator.speed = COSMETIC_RAND(6, 8);
                     sparkle->timer          = 2 * i++;
                 }
 
@@ -410,7 +413,7 @@ uint8 Ring_CheckPlatformCollisions(EntityPlatform *platform)
                 side = C_NONE;
                 if (RSDK.CheckObjectCollisionTouchBox(platform, &platform->hitbox, self, &Ring->hitbox)
                     && self->collisionLayers & Zone->moveLayerMask) {
-                    TileLayer *moveLayer  = RSDK.GetTileLayer(Zone->moveLayer);
+                    TileLayer *moveLayer  = Zone->moveTileLayer;
                     moveLayer->position.x = -(platform->drawPos.x + platform->tileOrigin.x) >> 16;
                     moveLayer->position.y = -(platform->drawPos.y + platform->tileOrigin.y) >> 16;
                 }
@@ -664,7 +667,7 @@ void Ring_State_Big(void)
     Ring_CheckObjectCollisions(x, y);
 
     if (!(self->angle & 0xF)) {
-        EntityRing *sparkle = CREATE_ENTITY(Ring, NULL, self->position.x + RSDK.Rand(-x, x), self->position.y + RSDK.Rand(-y, y));
+        EntityRing *sparkle = CREATE_ENTITY(Ring, NULL, self->position.x + COSMETIC_RAND(-x, x), self->position.y + COSMETIC_RAND(-y, y));
         sparkle->state      = Ring_State_Sparkle;
         sparkle->stateDraw  = Ring_Draw_Sparkle;
         sparkle->active     = ACTIVE_NORMAL;
@@ -19,7 +19,7 @@ void Soundboard_StaticUpdate(void)
         bool32 shouldStopSfx = true;
 
         if (Soundboard->sfxCheckCallback[s] && SceneInfo->state == ENGINESTATE_REGULAR) {
-            if (Soundboard->sfxCheckCallback[s]()) {
+            if ((!Soundboard->sfxUsesEmitters[s] || Soundboard_CheckEmittersNearScreens(s)) && Soundboard->sfxCheckCallback[s]()) {
                 shouldStopSfx                  = false;
                 Soundboard->sfxFadeOutTimer[s] = 0;
 
@@ -73,13 +73,21 @@ void Soundboard_StageLoad(void)
     Soundboard->sfxCount = 0;
 
     for (int32 i = 0; i < SOUNDBOARD_SFX_COUNT; ++i) {
-        Soundboard->sfxList[i]            = 0;
-        Soundboard->sfxLoopPoint[i]       = 0;
-        Soundboard->sfxCheckCallback[i]   = NULL;
-        Soundboard->sfxUpdateCallback[i]  = NULL;
-        Soundboard->sfxIsPlaying[i]       = false;
-        Soundboard->sfxPlayingTimer[i]    = 0;
-        Soundboard->sfxFadeOutDuration[i] = 0;
+        Soundboard->sfxList[i]               = 0;
+        Soundboard->sfxLoopPoint[i]          = 0;
+        Soundboard->sfxCheckCallback[i]      = NULL;
+        Soundboard->sfxUpdateCallback[i]     = NULL;
+        Soundboard->sfxIsPlaying[i]          = false;
+        Soundboard->sfxPlayingTimer[i]       = 0;
+        Soundboard->sfxFadeOutDuration[i]    = 0;
+        Soundboard->sfxUsesEmitters[i]       = false;
+        Soundboard->sfxEmittersOverflowed[i] = false;
+        Soundboard->sfxEmitterReach[i]       = 0;
+    }
+
+    Soundboard->emitterCount = 0;
+    for (int32 y = 0; y < SOUNDBOARD_GRID_SIZE; ++y) {
+        for (int32 x = 0; x < SOUNDBOARD_GRID_SIZE; ++x) Soundboard->emitterGrid[y][x] = SOUNDBOARD_EMITTER_NONE;
     }
 }
 
@@ -103,6 +111,104 @@ uint8 Soundboard_LoadSfx(const char *sfxName, uint32 loopPoint, bool32 (*checkCa
     return sfxID;
 }
 
+int32 Soundboard_AddEmitter(uint8 sfxID, void *entity, uint8 shape, int32 range, Vector2 *size)
+{
+    if (!Soundboard || sfxID >= Soundboard->sfxCount || Soundboard->sfxEmittersOverflowed[sfxID])
+        return -1;
+
+    // an incomplete registry would hide some emitters, so fall back to the sfx's own callbacks instead
+    if (Soundboard->emitterCount >= SOUNDBOARD_EMITTER_COUNT) {
+        Soundboard->sfxUsesEmitters[sfxID]       = false;
+        Soundboard->sfxEmittersOverflowed[sfxID] = true;
+        return -1;
+    }
+
+    Entity *emitter = (Entity *)entity;
+    int32 id        = Soundboard->emitterCount++;
+
+    Soundboard->emitterEntity[id] = emitter;
+    Soundboard->emitterSfx[id]    = sfxID;
+    Soundboard->emitterPos[id].x  = emitter->position.x >> 16;
+    Soundboard->emitterPos[id].y  = emitter->position.y >> 16;
+
+    // +1 covers MathHelpers_Distance rounding up to the range
+    Soundboard->emitterReach[id].x = range + 1;
+    Soundboard->emitterReach[id].y = range + 1;
+    if (shape == SOUNDBOARD_EMITTER_BOX) {
+        Soundboard->emitterReach[id].x += size->x;
+        Soundboard->emitterReach[id].y += size->y;
+    }
+
+    int32 cellX = CLAMP(Soundboard->emitterPos[id].x >> SOUNDBOARD_GRID_SHIFT, 0, SOUNDBOARD_GRID_SIZE - 1);
+    int32 cellY = CLAMP(Soundboard->emitterPos[id].y >> SOUNDBOARD_GRID_SHIFT, 0, SOUNDBOARD_GRID_SIZE - 1);
+
+    Soundboard->emitterNext[id]           = Soundboard->emitterGrid[cellY][cellX];
+    Soundboard->emitterGrid[cellY][cellX] = id;
+    Soundboard->sfxUsesEmitters[sfxID]    = true;
+    Soundboard->sfxEmitterReach[sfxID]    = MAX(Soundboard->sfxEmitterReach[sfxID], MAX(Soundboard->emitterReach[id].x, Soundboard->emitterReach[id].y));
+
+    return id;
+}
+
+bool32 Soundboard_CheckEmittersNearScreens(uint8 sfxID)
+{
+    for (int32 s = 0; s < RSDK.GetVideoSetting(VIDEOSETTING_SCREENCOUNT); ++s) {
+        int32 screenX = (ScreenInfo[s].position.x + ScreenInfo[s].center.x) << 16;
+        int32 screenY = (ScreenInfo[s].position.y + ScreenInfo[s].center.y) << 16;
+
+        if (Soundboard_GetNearbyEmitters(sfxID, screenX, screenY, NULL, 1))
+            return true;
+    }
+
+    return false;
+}
+
+int32 Soundboard_GetNearbyEmitters(uint8 sfxID, int32 x, int32 y, Entity **emitters, int32 maxCount)
+{
+    x >>= 16;
+    y >>= 16;
+    maxCount = MIN(maxCount, SOUNDBOARD_EMITTER_COUNT);
+
+    int32 reach  = Soundboard->sfxEmitterReach[sfxID];
+    int32 left   = CLAMP((x - reach) >> SOUNDBOARD_GRID_SHIFT, 0, SOUNDBOARD_GRID_SIZE - 1);
+    int32 top    = CLAMP((y - reach) >> SOUNDBOARD_GRID_SHIFT, 0, SOUNDBOARD_GRID_SIZE - 1);
+    int32 right  = CLAMP((x + reach) >> SOUNDBOARD_GRID_SHIFT, 0, SOUNDBOARD_GRID_SIZE - 1);
+    int32 bottom = CLAMP((y + reach) >> SOUNDBOARD_GRID_SHIFT, 0, SOUNDBOARD_GRID_SIZE - 1);
+
+    int32 count = 0;
+    uint32 distances[SOUNDBOARD_EMITTER_COUNT];
+    for (int32 cy = top; cy <= bottom; ++cy) {
+        for (int32 cx = left; cx <= right; ++cx) {
+            for (uint16 id = Soundboard->emitterGrid[cy][cx]; id != SOUNDBOARD_EMITTER_NONE; id = Soundboard->emitterNext[id]) {
+                int32 distX = abs(Soundboard->emitterPos[id].x - x);
+                int32 distY = abs(Soundboard->emitterPos[id].y - y);
+                if (Soundboard->emitterSfx[id] != sfxID || distX > Soundboard->emitterReach[id].x || distY > Soundboard->emitterReach[id].y)
+                    continue;
+
+                if (!emitters)
+                    return 1;
+
+                // keep the list sorted closest first, dropping the furthest once it's full
+                uint32 dist = distX * distX + distY * distY;
+                int32 slot  = count < maxCount ? count++ : maxCount;
+                for (; slot > 0 && distances[slot - 1] > dist; --slot) {
+                    if (slot < maxCount) {
+                        distances[slot] = distances[slot - 1];
+                        emitters[slot]  = emitters[slot - 1];
+                    }
+                }
+
+                if (slot < maxCount) {
+                    distances[slot] = dist;
+                    emitters[slot]  = Soundboard->emitterEntity[id];
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
 #if GAME_INCLUDE_EDITOR
 void Soundboard_EditorDraw(void) {}
 
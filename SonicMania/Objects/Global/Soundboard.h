@@ -5,6 +5,16 @@
 
 #define SOUNDBOARD_SFX_COUNT (32)
 
+#define SOUNDBOARD_EMITTER_COUNT (0x200)
+#define SOUNDBOARD_EMITTER_NONE  (0xFFFF)
+#define SOUNDBOARD_GRID_SHIFT    (9) // 512px cells
+#define SOUNDBOARD_GRID_SIZE     (0x40)
+
+typedef enum {
+    SOUNDBOARD_EMITTER_POINT,
+    SOUNDBOARD_EMITTER_BOX,
+} SoundboardEmitterShapes;
+
 // Object Class
 struct ObjectSoundboard {
     RSDK_OBJECT
@@ -18,6 +28,16 @@ struct ObjectSoundboard {
     int32 sfxPlayingTimer[SOUNDBOARD_SFX_COUNT];
     int32 sfxFadeOutTimer[SOUNDBOARD_SFX_COUNT];
     int32 sfxFadeOutDuration[SOUNDBOARD_SFX_COUNT];
+    bool32 sfxUsesEmitters[SOUNDBOARD_SFX_COUNT];
+    bool32 sfxEmittersOverflowed[SOUNDBOARD_SFX_COUNT];
+    int32 sfxEmitterReach[SOUNDBOARD_SFX_COUNT];
+    int32 emitterCount;
+    Entity *emitterEntity[SOUNDBOARD_EMITTER_COUNT];
+    uint8 emitterSfx[SOUNDBOARD_EMITTER_COUNT];
+    Vector2 emitterPos[SOUNDBOARD_EMITTER_COUNT];
+    Vector2 emitterReach[SOUNDBOARD_EMITTER_COUNT];
+    uint16 emitterNext[SOUNDBOARD_EMITTER_COUNT];
+    uint16 emitterGrid[SOUNDBOARD_GRID_SIZE][SOUNDBOARD_GRID_SIZE];
 };
 
 // Entity Class
@@ -44,4 +64,13 @@ void Soundboard_Serialize(void);
 // Extra Entity Functions
 uint8 Soundboard_LoadSfx(const char *sfxName, uint32 loopPoint, bool32 (*checkCallback)(void), void (*updateCallback)(int32 sfxID));
 
+// Positional Emitters
+// registers a (static) entity as a source for sfxID, range is how far (in pixels) from the shape the sfx can be heard
+// once an sfx has emitters, its check callback is skipped whenever none of them are within range of a screen
+// if the registry fills up, that sfx stops using emitters entirely (so its callbacks go back to checking every entity)
+int32 Soundboard_AddEmitter(uint8 sfxID, void *entity, uint8 shape, int32 range, Vector2 *size);
+bool32 Soundboard_CheckEmittersNearScreens(uint8 sfxID);
+// fills "emitters" with up to maxCount of the closest emitters that could be in range of x/y, returns the count
+int32 Soundboard_GetNearbyEmitters(uint8 sfxID, int32 x, int32 y, Entity **emitters, int32 maxCount);
+
 #endif //! OBJ_SOUNDBOARD_H
@@ -109,10 +109,7 @@ void SpecialRing_StageLoad(void)
                             else
                                 player2->position.x -= TO_FIXED(16);
 
-                            for (int32 f = 0; f < 0x10; ++f) {
-                                Player->leaderPositionBuffer[f].x = player->position.x;
-                                Player->leaderPositionBuffer[f].y = player->position.y;
-                            }
+                            Player_ResetLeaderPositions(&player->position);
                         }
                     }
                 }
@@ -414,16 +414,16 @@ void Spikes_Draw_Glint(void)
 {
     RSDK_THIS(Spikes);
 
-    Vector2 drawPos = self->position;
-    int32 cnt       = self->count >> 1;
+    Vector2 drawPos  = self->position;
+    Vector2 drawStep = { 0, 0 };
+    int32 cnt        = self->count >> 1;
     switch (self->type) {
         case C_TOP:
         case C_BOTTOM:
-            drawPos.x = TO_FIXED(16) - (self->count << 19) + self->position.x;
-            for (; cnt; --cnt) {
-                RSDK.DrawSprite(&Spikes->verticalAnimator, &drawPos, false);
-                drawPos.x += TO_FIXED(32);
-            }
+            drawPos.x  = TO_FIXED(16) - (self->count << 19) + self->position.x;
+            drawStep.x = TO_FIXED(32);
+            DrawHelpers_DrawSpriteStrip(&Spikes->verticalAnimator, &drawPos, &drawStep, cnt, false);
+            drawPos.x += cnt * TO_FIXED(32);
 
             if (self->count & 1) {
                 drawPos.x -= TO_FIXED(16);
@@ -433,11 +433,10 @@ void Spikes_Draw_Glint(void)
 
         case C_LEFT:
         case C_RIGHT:
-            drawPos.y = TO_FIXED(16) - (self->count << 19) + self->position.y;
-            for (; cnt; --cnt) {
-                RSDK.DrawSprite(&Spikes->horizontalAnimator, &drawPos, false);
-                drawPos.y += TO_FIXED(32);
-            }
+            drawPos.y  = TO_FIXED(16) - (self->count << 19) + self->position.y;
+            drawStep.y = TO_FIXED(32);
+            DrawHelpers_DrawSpriteStrip(&Spikes->horizontalAnimator, &drawPos, &drawStep, cnt, false);
+            drawPos.y += cnt * TO_FIXED(32);
 
             if (self->count & 1) {
                 drawPos.y -= TO_FIXED(16);
@@ -458,17 +457,17 @@ void Spikes_Draw_Global(void)
 {
     RSDK_THIS(Spikes);
 
-    Vector2 drawPos = self->position;
-    int32 cnt       = self->count >> 1;
+    Vector2 drawPos  = self->position;
+    Vector2 drawStep = { 0, 0 };
+    int32 cnt        = self->count >> 1;
 
     switch (self->type) {
         case C_TOP:
         case C_BOTTOM:
-            drawPos.x = (TO_FIXED(16) - (self->count << 19)) + self->position.x;
-            for (; cnt; --cnt) {
-                RSDK.DrawSprite(&Spikes->verticalAnimator, &drawPos, false);
-                drawPos.x += TO_FIXED(32);
-            }
+            drawPos.x  = (TO_FIXED(16) - (self->count << 19)) + self->position.x;
+            drawStep.x = TO_FIXED(32);
+            DrawHelpers_DrawSpriteStrip(&Spikes->verticalAnimator, &drawPos, &drawStep, cnt, false);
+            drawPos.x += cnt * TO_FIXED(32);
 
             if (self->count & 1) {
                 drawPos.x -= TO_FIXED(16);
@@ -478,11 +477,10 @@ void Spikes_Draw_Global(void)
 
         case C_LEFT:
         case C_RIGHT:
-            drawPos.y = (TO_FIXED(16) - (self->count << 19)) + self->position.y;
-            for (; cnt; --cnt) {
-                RSDK.DrawSprite(&Spikes->horizontalAnimator, &drawPos, false);
-                drawPos.y += TO_FIXED(32);
-            }
+            drawPos.y  = (TO_FIXED(16) - (self->count << 19)) + self->position.y;
+            drawStep.y = TO_FIXED(32);
+            DrawHelpers_DrawSpriteStrip(&Spikes->horizontalAnimator, &drawPos, &drawStep, cnt, false);
+            drawPos.y += cnt * TO_FIXED(32);
 
             if (self->count & 1) {
                 drawPos.y -= TO_FIXED(16);
@@ -131,10 +131,7 @@ void StarPost_StageLoad(void)
                         else
                             sidekick->position.x -= TO_FIXED(16);
 
-                        for (int32 i = 0; i < 0x10; ++i) {
-                            Player->leaderPositionBuffer[i].x = player->position.x;
-                            Player->leaderPositionBuffer[i].y = player->position.y;
-                        }
+                        Player_ResetLeaderPositions(&player->position);
                     }
                 }
             }
@@ -10,6 +10,41 @@
 
 ObjectZone *Zone;
 
+// Checked in the same order Zone_GetZoneID always has
+static const ZoneSceneFolder sceneFolderList[] = {
+    { "GHZ", SCENEFOLDER_GHZ, ZONE_GHZ },
+    { "CPZ", SCENEFOLDER_CPZ, ZONE_CPZ },
+    { "SPZ1", SCENEFOLDER_SPZ1, ZONE_SPZ },
+    { "SPZ2", SCENEFOLDER_SPZ2, ZONE_SPZ },
+    { "FBZ", SCENEFOLDER_FBZ, ZONE_FBZ },
+    { "PSZ1", SCENEFOLDER_PSZ1, ZONE_PGZ },
+    { "PSZ2", SCENEFOLDER_PSZ2, ZONE_PGZ },
+    { "SSZ1", SCENEFOLDER_SSZ1, ZONE_SSZ },
+    { "SSZ2", SCENEFOLDER_SSZ2, ZONE_SSZ },
+    { "HCZ", SCENEFOLDER_HCZ, ZONE_HCZ },
+    { "MSZ", SCENEFOLDER_MSZ, ZONE_MSZ },
+    { "OOZ1", SCENEFOLDER_OOZ1, ZONE_OOZ },
+    { "OOZ2", SCENEFOLDER_OOZ2, ZONE_OOZ },
+    { "LRZ1", SCENEFOLDER_LRZ1, ZONE_LRZ },
+    { "LRZ2", SCENEFOLDER_LRZ2, ZONE_LRZ },
+    { "LRZ3", SCENEFOLDER_LRZ3, ZONE_LRZ },
+    { "MMZ", SCENEFOLDER_MMZ, ZONE_MMZ },
+    { "TMZ1", SCENEFOLDER_TMZ1, ZONE_TMZ },
+    { "TMZ2", SCENEFOLDER_TMZ2, ZONE_TMZ },
+    { "TMZ3", SCENEFOLDER_TMZ3, ZONE_TMZ },
+    { "ERZ", SCENEFOLDER_ERZ, ZONE_ERZ },
+#if MANIA_USE_PLUS
+    { "AIZ", SCENEFOLDER_AIZ, ZONE_AIZ }, // only counts as a zone in encore mode
+#else
+    { "AIZ", SCENEFOLDER_AIZ, ZONE_INVALID },
+#endif
+    { "GHZCutscene", SCENEFOLDER_GHZCUTSCENE, ZONE_INVALID },
+    { "MSZCutscene", SCENEFOLDER_MSZCUTSCENE, ZONE_INVALID },
+    { "HPZ", SCENEFOLDER_HPZ, ZONE_INVALID },
+    { "Blueprint", SCENEFOLDER_BLUEPRINT, ZONE_INVALID },
+    { "Puyo", SCENEFOLDER_PUYO, ZONE_INVALID },
+};
+
 void Zone_Update(void) {}
 
 void Zone_LateUpdate(void)
@@ -77,6 +112,12 @@ void Zone_LateUpdate(void)
 
 void Zone_StaticUpdate(void)
 {
+#if GAME_RECORD_ASSET_MANIFEST
+    // every StageLoad has run by the time the first update happens
+    if (Zone->manifestRecording)
+        Zone_FinishAssetManifest();
+#endif
+
     // Global timer, used to keep various objects in sync
     // This timer is reset every time a stage is loaded
     ++Zone->timer;
@@ -88,6 +129,19 @@ void Zone_StaticUpdate(void)
     ++Zone->persistentTimer;
     Zone->persistentTimer &= 0x7FFF;
 
+    // sample the temp range every frame, the create cursor finding free slots doesn't mean the range isn't getting full
+    // (InitGameLogic checked the entity list is one contiguous array, so the range can be walked directly instead of a GetEntity call per slot)
+    EntityBase *tempEntities = (EntityBase *)RSDK.GetEntity(TEMPENTITY_START);
+    int32 liveCount          = 0;
+    for (int32 i = 0; i < TEMPENTITY_COUNT; ++i) {
+        if (tempEntities[i].classID != TYPE_BLANK)
+            ++liveCount;
+    }
+
+    Zone->tempEntityCount = liveCount;
+    if (liveCount > Zone->tempEntityHighWater)
+        Zone->tempEntityHighWater = liveCount;
+
     // Ring Frame timer, used to keep all the rings animating using the same frame
     if (!(Zone->timer & 1)) {
         ++Zone->ringFrame;
@@ -136,9 +190,17 @@ void Zone_Create(void *data)
 
 void Zone_StageLoad(void)
 {
+    Zone_ResolveSceneIdentity();
+#if GAME_RECORD_ASSET_MANIFEST
+    Zone_StartAssetManifest();
+#endif
+
 #if MANIA_USE_PLUS
     // Set the random seed to a "random" value
     Zone->randSeed = (uint32)time(NULL);
+#if GAME_SPLIT_COSMETIC_RAND
+    Zone->cosmeticRandSeed = Zone->randSeed;
+#endif
 
     // Setup encore character flags & stock if needed
     SaveRAM *saveRAM = SaveGame_GetSaveRAM();
@@ -179,6 +241,11 @@ void Zone_StageLoad(void)
     Zone->gotTimeOver     = false;
     Zone->vsSwapCBCount   = 0;
 
+    Zone->tempEntityCount     = 0;
+    Zone->tempEntityHighWater = 0;
+    Zone->tempOverflowCount   = 0;
+    memset(Zone->tempOverflows, 0, sizeof(Zone->tempOverflows));
+
     // Setup draw group ids (shouldn't be changed after this, but can be if needed)
     Zone->fgDrawGroup[0]     = 0;
     Zone->objectDrawGroup[0] = 2;
@@ -196,6 +263,10 @@ void Zone_StageLoad(void)
     Zone->scratchLayer = RSDK.GetTileLayerID("Scratch");
 #endif
 
+    Zone->fgTileLayer[0] = RSDK.GetTileLayer(Zone->fgLayer[0]);
+    Zone->fgTileLayer[1] = RSDK.GetTileLayer(Zone->fgLayer[1]);
+    Zone->moveTileLayer  = RSDK.GetTileLayer(Zone->moveLayer);
+
     // Layer Masks
 
     // (Not sure why this one is different from the two below, but whatever works)
@@ -317,39 +388,51 @@ void Zone_StageLoad(void)
 
 int32 Zone_GetZoneID(void)
 {
-    if (RSDK.CheckSceneFolder("GHZ"))
-        return ZONE_GHZ;
-    if (RSDK.CheckSceneFolder("CPZ"))
-        return ZONE_CPZ;
-    if (RSDK.CheckSceneFolder("SPZ1") || RSDK.CheckSceneFolder("SPZ2"))
-        return ZONE_SPZ;
-    if (RSDK.CheckSceneFolder("FBZ"))
-        return ZONE_FBZ;
-    if (RSDK.CheckSceneFolder("PSZ1") || RSDK.CheckSceneFolder("PSZ2"))
-        return ZONE_PGZ;
-    if (RSDK.CheckSceneFolder("SSZ1") || RSDK.CheckSceneFolder("SSZ2"))
-        return ZONE_SSZ;
-    if (RSDK.CheckSceneFolder("HCZ"))
-        return ZONE_HCZ;
-    if (RSDK.CheckSceneFolder("MSZ"))
-        return ZONE_MSZ;
-    if (RSDK.CheckSceneFolder("OOZ1") || RSDK.CheckSceneFolder("OOZ2"))
-        return ZONE_OOZ;
-    if (RSDK.CheckSceneFolder("LRZ1") || RSDK.CheckSceneFolder("LRZ2") || RSDK.CheckSceneFolder("LRZ3"))
-        return ZONE_LRZ;
-    if (RSDK.CheckSceneFolder("MMZ"))
-        return ZONE_MMZ;
-    if (RSDK.CheckSceneFolder("TMZ1") || RSDK.CheckSceneFolder("TMZ2") || RSDK.CheckSceneFolder("TMZ3"))
-        return ZONE_TMZ;
-    if (RSDK.CheckSceneFolder("ERZ"))
-        return ZONE_ERZ;
+    if (Zone) {
+        if (Zone->sceneListID != SceneInfo->listPos + 1)
+            Zone_ResolveSceneIdentity();
+
+        return Zone->sceneZoneID;
+    }
+
+    for (int32 i = 0; i < (int32)(sizeof(sceneFolderList) / sizeof(sceneFolderList[0])); ++i) {
+        if (RSDK.CheckSceneFolder(sceneFolderList[i].folder)) {
 #if MANIA_USE_PLUS
-    if (RSDK.CheckSceneFolder("AIZ") && globals->gameMode == MODE_ENCORE)
-        return ZONE_AIZ;
+            if (sceneFolderList[i].zoneID == ZONE_AIZ && globals->gameMode != MODE_ENCORE)
+                return ZONE_INVALID;
 #endif
+            return sceneFolderList[i].zoneID;
+        }
+    }
+
     return ZONE_INVALID;
 }
 
+void Zone_ResolveSceneIdentity(void)
+{
+    Zone->sceneZoneID  = ZONE_INVALID;
+    Zone->sceneFolders = 0;
+#if MANIA_USE_PLUS
+    Zone->sceneEncore = globals->gameMode == MODE_ENCORE;
+#else
+    Zone->sceneEncore = false;
+#endif
+
+    for (int32 i = 0; i < (int32)(sizeof(sceneFolderList) / sizeof(sceneFolderList[0])); ++i) {
+        if (RSDK.CheckSceneFolder(sceneFolderList[i].folder)) {
+            Zone->sceneFolders = sceneFolderList[i].tag;
+            Zone->sceneZoneID  = sceneFolderList[i].zoneID;
+#if MANIA_USE_PLUS
+            if (Zone->sceneZoneID == ZONE_AIZ && !Zone->sceneEncore)
+                Zone->sceneZoneID = ZONE_INVALID;
+#endif
+            break;
+        }
+    }
+
+    Zone->sceneListID = SceneInfo->listPos + 1;
+}
+
 void Zone_StoreEntities(int32 xOffset, int32 yOffset)
 {
     // "Normalize" the positions of players, signposts & itemboxes when we store them
@@ -507,8 +590,8 @@ void Zone_RotateOnPivot(Vector2 *pivotPos, Vector2 *originPos, int32 angle)
 {
     int32 x     = (pivotPos->x - originPos->x) >> 8;
     int32 y     = (pivotPos->y - originPos->y) >> 8;
-    pivotPos->x = originPos->x + y * RSDK.Sin256(angle) + x * RSDK.Cos256(angle);
-    pivotPos->y = originPos->y + y * RSDK.Cos256(angle) - x * RSDK.Sin256(angle);
+    pivotPos->x = originPos->x + y * SIN256(angle) + x * COS256(angle);
+    pivotPos->y = originPos->y + y * COS256(angle) - x * SIN256(angle);
 }
 
 void Zone_ReloadScene(int32 screen)
@@ -682,6 +765,83 @@ void Zone_ApplyWorldBounds(void)
     }
 }
 
+Entity *Zone_CreateTempEntity(uint16 classID, void *data, int32 x, int32 y)
+{
+    // Zone isn't loaded in every scene (menus, special stages, etc), those just get the engine's default behaviour
+    if (Zone) {
+        Entity *next = RSDK_GET_ENTITY_GEN(SceneInfo->createSlot);
+        if (next->classID != TYPE_BLANK && !next->isPermanent)
+            Zone_FindFreeTempSlot(classID);
+    }
+
+    return RSDK.CreateEntity(classID, data, x, y);
+}
+
+void Zone_FindFreeTempSlot(uint16 classID)
+{
+    int32 liveCount    = 0;
+    int32 freeSlot     = -1;
+    int32 cosmeticSlot = -1;
+
+    // scan from the create cursor so the engine's round-robin order is kept as much as possible
+    EntityBase *tempEntities = (EntityBase *)RSDK.GetEntity(TEMPENTITY_START);
+    int32 slot               = SceneInfo->createSlot;
+    for (int32 i = 0; i < TEMPENTITY_COUNT; ++i) {
+        EntityBase *entity = &tempEntities[slot - TEMPENTITY_START];
+
+        if (entity->classID == TYPE_BLANK) {
+            if (freeSlot < 0)
+                freeSlot = slot;
+        }
+        else {
+            ++liveCount;
+            if (cosmeticSlot < 0 && !entity->isPermanent && Zone_IsCosmeticClass(entity->classID))
+                cosmeticSlot = slot;
+        }
+
+        if (++slot >= ENTITY_COUNT)
+            slot = TEMPENTITY_START;
+    }
+
+    Zone->tempEntityCount = liveCount;
+    if (liveCount > Zone->tempEntityHighWater)
+        Zone->tempEntityHighWater = liveCount;
+
+    if (freeSlot >= 0) {
+        SceneInfo->createSlot = freeSlot;
+    }
+    else {
+        ++Zone->tempOverflowCount;
+        if (classID < TYPE_COUNT && Zone->tempOverflows[classID] < 0xFFFF)
+            ++Zone->tempOverflows[classID];
+
+        // if there's nothing cosmetic to get rid of then the engine just overwrites whatever's next, same as it always did
+        if (cosmeticSlot >= 0)
+            SceneInfo->createSlot = cosmeticSlot;
+    }
+}
+
+bool32 Zone_IsCosmeticClass(uint16 classID)
+{
+    if (classID == TYPE_BLANK)
+        return false;
+
+    return (Debris && classID == Debris->classID) || (Dust && classID == Dust->classID) || (Explosion && classID == Explosion->classID);
+}
+
+bool32 Zone_CheckPosOnCurrentScreen(Vector2 *position, Vector2 *range)
+{
+    RSDKScreenInfo *screen = &ScreenInfo[SceneInfo->currentScreenID];
+
+    int32 x      = FROM_FIXED(position->x);
+    int32 y      = FROM_FIXED(position->y);
+    int32 rangeX = FROM_FIXED(range->x);
+    int32 rangeY = FROM_FIXED(range->y);
+
+    return x + rangeX >= screen->position.x && x - rangeX < screen->position.x + screen->size.x && y + rangeY >= screen->position.y
+           && y - rangeY < screen->position.y + screen->size.y;
+}
+
 // Generally, this is just "isAct2", however stuff like LRZ3, SSZ boss, TMZ3 & ERZ's cases prove thats not always the case
 bool32 Zone_IsZoneLastAct(void)
 {
@@ -803,9 +963,9 @@ void Zone_State_FadeOut(void)
             globals->restartMinutes      = SceneInfo->minutes;
 
             EntityPlayer *player = RSDK_GET_ENTITY(SLOT_PLAYER1, Player);
-            RSDK.CopyEntity(&Zone->entityStorage[0], player, false);
+            RSDK.CopyEntity(&Zone->entityStorage[ZONE_STORAGE_PLAYER(0)], player, false);
             if (player->camera)
-                RSDK.CopyEntity(&Zone->entityStorage[8], player->camera, false);
+                RSDK.CopyEntity(&Zone->entityStorage[ZONE_STORAGE_CAMERA(0)], player->camera, false);
         }
 #endif
 
@@ -905,153 +1065,79 @@ void Zone_State_FadeOut_Destroy(void)
 
 void Zone_HandlePlayerSwap(void)
 {
-    int32 playerBoundActiveB[PLAYER_COUNT];
-    int32 playerBoundActiveT[PLAYER_COUNT];
-    int32 playerBoundActiveR[PLAYER_COUNT];
-    int32 playerBoundActiveL[PLAYER_COUNT];
-    int32 deathBounds[PLAYER_COUNT];
-    int32 playerBoundsB[PLAYER_COUNT];
-    int32 playerBoundsT[PLAYER_COUNT];
-    int32 playerBoundsR[PLAYER_COUNT];
-    int32 playerBoundsL[PLAYER_COUNT];
-    int32 cameraBoundsB[PLAYER_COUNT];
-    int32 cameraBoundsT[PLAYER_COUNT];
-    int32 cameraBoundsR[PLAYER_COUNT];
-    int32 cameraBoundsL[PLAYER_COUNT];
-    uint8 layerIDs[PLAYER_COUNT][LAYER_COUNT];
-
 #if MANIA_USE_PLUS
-    for (int32 p = 0; p < Player->playerCount; ++p) {
-        EntityPlayer *player = RSDK_GET_ENTITY(Zone->preSwapPlayerIDs[p], Player);
-        RSDK.CopyEntity(&Zone->entityStorage[p], player, false);
-
-        cameraBoundsL[p]      = Zone->cameraBoundsL[p];
-        cameraBoundsR[p]      = Zone->cameraBoundsR[p];
-        cameraBoundsT[p]      = Zone->cameraBoundsT[p];
-        cameraBoundsB[p]      = Zone->cameraBoundsB[p];
-        playerBoundsL[p]      = Zone->playerBoundsL[p];
-        playerBoundsR[p]      = Zone->playerBoundsR[p];
-        playerBoundsT[p]      = Zone->playerBoundsT[p];
-        playerBoundsB[p]      = Zone->playerBoundsB[p];
-        deathBounds[p]        = Zone->deathBoundary[p];
-        playerBoundActiveL[p] = Zone->playerBoundActiveL[p];
-        playerBoundActiveR[p] = Zone->playerBoundActiveR[p];
-        playerBoundActiveT[p] = Zone->playerBoundActiveT[p];
-        playerBoundActiveB[p] = Zone->playerBoundActiveB[p];
+    ZoneSwapState swapStates[PLAYER_COUNT];
 
-        for (int32 l = 0; l < LAYER_COUNT; ++l) {
-            TileLayer *layer = RSDK.GetTileLayer(l);
-            if (layer)
-                layerIDs[p][l] = layer->drawGroup[Zone->preSwapPlayerIDs[p]];
-            else
-                layerIDs[p][l] = DRAWGROUP_COUNT;
-        }
+    // Player-owned entities, indexed by player slot
+    // rather than bouncing every entity through Zone->entityStorage, these get permuted in-place
+    Entity *cameras[PLAYER_COUNT];
+    Entity *powerups[PLAYER_COUNT];
+    Entity *trails[PLAYER_COUNT];
 
-        EntityCamera *camera = player->camera;
-        RSDK.CopyEntity(&Zone->entityStorage[8 + p], camera, false);
-        Zone->screenPosX[p] = ScreenInfo[camera->screenID].position.x;
-        Zone->screenPosY[p] = ScreenInfo[camera->screenID].position.y;
+    Entity *camTargets[PLAYER_COUNT];
+    StateMachine(camStates[PLAYER_COUNT]);
+    int32 camScreens[PLAYER_COUNT];
 
-        RSDK.CopyEntity(&Zone->entityStorage[4 + p], RSDK_GET_ENTITY(Player->playerCount + Zone->preSwapPlayerIDs[p], Shield), false);
-        RSDK.CopyEntity(&Zone->entityStorage[12 + p], RSDK_GET_ENTITY((2 * Player->playerCount) + Zone->preSwapPlayerIDs[p], ImageTrail), false);
-    }
+    for (int32 p = 0; p < Zone->swapPlayerCount; ++p) {
+        int32 playerID       = Zone->preSwapPlayerIDs[p];
+        EntityPlayer *player = RSDK_GET_ENTITY(playerID, Player);
+        Zone_StoreSwapState(&swapStates[p], player);
 
-    for (int32 p = 0; p < Player->playerCount; ++p) {
-        EntityPlayer *player       = RSDK_GET_ENTITY(Zone->swappedPlayerIDs[p], Player);
-        EntityPlayer *storedPlayer = (EntityPlayer *)&Zone->entityStorage[p];
+        EntityCamera *camera = player->camera;
+        Zone->screenPosX[p]  = ScreenInfo[camera->screenID].position.x;
+        Zone->screenPosY[p]  = ScreenInfo[camera->screenID].position.y;
 
-        void *state = storedPlayer->state;
-        if (state == Player_State_Ground || state == Player_State_Air || state == Player_State_Roll || state == Player_State_TubeRoll
-            || state == Player_State_TubeAirRoll) {
-            player->state           = state;
-            player->nextAirState    = storedPlayer->nextAirState;
-            player->nextGroundState = storedPlayer->nextGroundState;
-            player->onGround        = storedPlayer->onGround;
-            player->groundedStore   = storedPlayer->groundedStore;
-            for (int32 i = 0; i < 8; ++i) {
-                player->abilityValues[i] = storedPlayer->abilityValues[i];
-                player->abilityPtrs[i]   = storedPlayer->abilityPtrs[i];
-            }
-            player->angle          = storedPlayer->angle;
-            player->rotation       = storedPlayer->rotation;
-            player->direction      = storedPlayer->direction;
-            player->tileCollisions = storedPlayer->tileCollisions;
-            player->interaction    = storedPlayer->interaction;
-            RSDK.SetSpriteAnimation(player->aniFrames, storedPlayer->animator.animationID, &player->animator, false, 0);
-        }
-        else {
-            player->state = Player_State_Air;
-            RSDK.SetSpriteAnimation(player->aniFrames, ANI_JUMP, &player->animator, false, 0);
-            player->tileCollisions = TILECOLLISION_DOWN;
-            player->interaction    = true;
-        }
+        // the camera keeps following the same player on the same screen, so these don't move with the rest of it
+        camTargets[playerID] = camera->target;
+        camStates[playerID]  = camera->state;
+        camScreens[playerID] = camera->screenID;
 
-        player->position.x      = storedPlayer->position.x;
-        player->position.y      = storedPlayer->position.y;
-        player->velocity.x      = storedPlayer->velocity.x;
-        player->velocity.y      = storedPlayer->velocity.y;
-        player->groundVel       = storedPlayer->groundVel;
-        player->shield          = storedPlayer->shield;
-        player->collisionLayers = storedPlayer->collisionLayers;
-        player->collisionPlane  = storedPlayer->collisionPlane;
-        player->collisionMode   = storedPlayer->collisionMode;
-        player->invincibleTimer = storedPlayer->invincibleTimer;
-        player->speedShoesTimer = storedPlayer->speedShoesTimer;
-        player->blinkTimer      = storedPlayer->blinkTimer;
-        player->visible         = storedPlayer->visible;
-        Player_UpdatePhysicsState(player);
-
-        Zone->cameraBoundsL[Zone->swappedPlayerIDs[p]]      = cameraBoundsL[p];
-        Zone->cameraBoundsR[Zone->swappedPlayerIDs[p]]      = cameraBoundsR[p];
-        Zone->cameraBoundsT[Zone->swappedPlayerIDs[p]]      = cameraBoundsT[p];
-        Zone->cameraBoundsB[Zone->swappedPlayerIDs[p]]      = cameraBoundsB[p];
-        Zone->playerBoundsL[Zone->swappedPlayerIDs[p]]      = playerBoundsL[p];
-        Zone->playerBoundsR[Zone->swappedPlayerIDs[p]]      = playerBoundsR[p];
-        Zone->playerBoundsT[Zone->swappedPlayerIDs[p]]      = playerBoundsT[p];
-        Zone->playerBoundsB[Zone->swappedPlayerIDs[p]]      = playerBoundsB[p];
-        Zone->deathBoundary[Zone->swappedPlayerIDs[p]]      = deathBounds[p];
-        Zone->playerBoundActiveL[Zone->swappedPlayerIDs[p]] = playerBoundActiveL[p];
-        Zone->playerBoundActiveR[Zone->swappedPlayerIDs[p]] = playerBoundActiveR[p];
-        Zone->playerBoundActiveT[Zone->swappedPlayerIDs[p]] = playerBoundActiveT[p];
-        Zone->playerBoundActiveB[Zone->swappedPlayerIDs[p]] = playerBoundActiveB[p];
+        cameras[playerID]  = (Entity *)camera;
+        powerups[playerID] = RSDK_GET_ENTITY_GEN(Player->playerCount + playerID);
+        trails[playerID]   = RSDK_GET_ENTITY_GEN((2 * Player->playerCount) + playerID);
+    }
 
-        for (int32 l = 0; l < LAYER_COUNT; ++l) {
-            TileLayer *layer                            = RSDK.GetTileLayer(l);
-            layer->drawGroup[Zone->swappedPlayerIDs[p]] = layerIDs[p][l];
-        }
+    // powerup slots can hold shields, invincibility stars & the like, so move the whole entity
+    Zone_PermuteEntities(cameras, Zone->preSwapPlayerIDs, Zone->swappedPlayerIDs, Zone->swapPlayerCount, sizeof(EntityCamera));
+    Zone_PermuteEntities(powerups, Zone->preSwapPlayerIDs, Zone->swappedPlayerIDs, Zone->swapPlayerCount, sizeof(EntityBase));
+    Zone_PermuteEntities(trails, Zone->preSwapPlayerIDs, Zone->swappedPlayerIDs, Zone->swapPlayerCount, sizeof(EntityBase));
 
-        EntityCamera *camera = player->camera;
-        void *camTarget      = camera->target;
-        void *camState       = camera->state;
-        int32 camScreen      = camera->screenID;
-        RSDK.CopyEntity(camera, &Zone->entityStorage[8 + p], false);
-
-        camera->target                          = camTarget;
-        camera->screenID                        = camScreen;
-        camera->state                           = camState;
+    for (int32 p = 0; p < Zone->swapPlayerCount; ++p) {
+        int32 playerID       = Zone->swappedPlayerIDs[p];
+        EntityPlayer *player = RSDK_GET_ENTITY(playerID, Player);
+        Zone_RestoreSwapState(&swapStates[p], player);
+
+        EntityCamera *camera                    = player->camera;
+        camera->target                          = camTargets[playerID];
+        camera->screenID                        = camScreens[playerID];
+        camera->state                           = camStates[playerID];
         ScreenInfo[camera->screenID].position.x = Zone->screenPosX[p];
         ScreenInfo[camera->screenID].position.y = Zone->screenPosY[p];
+        camera->position.x                      = player->position.x;
+        camera->position.y                      = player->position.y;
 
-        EntityShield *shield = RSDK_GET_ENTITY(Player->playerCount + Zone->swappedPlayerIDs[p], Shield);
-        RSDK.CopyEntity(shield, &Zone->entityStorage[4 + p], false);
-        shield->player = storedPlayer;
-
-        EntityImageTrail *trail = RSDK_GET_ENTITY((2 * Player->playerCount) + Zone->swappedPlayerIDs[p], ImageTrail);
-        RSDK.CopyEntity(trail, &Zone->entityStorage[12 + p], false);
-        trail->player = storedPlayer;
+        EntityShield *shield = RSDK_GET_ENTITY(Player->playerCount + playerID, Shield);
+        shield->player       = player;
 
-        EntityCamera *cam = player->camera;
-        if (cam) {
-            cam->position.x = player->position.x;
-            cam->position.y = player->position.y;
-        }
-
-        memset(&Zone->entityStorage[0 + p], 0, sizeof(EntityBase));
-        memset(&Zone->entityStorage[4 + p], 0, sizeof(EntityBase));
-        memset(&Zone->entityStorage[8 + p], 0, sizeof(EntityBase));
-        memset(&Zone->entityStorage[12 + p], 0, sizeof(EntityBase));
+        EntityImageTrail *trail = RSDK_GET_ENTITY((2 * Player->playerCount) + playerID, ImageTrail);
+        trail->player           = player;
     }
 #else
+    int32 playerBoundActiveB[PLAYER_COUNT];
+    int32 playerBoundActiveT[PLAYER_COUNT];
+    int32 playerBoundActiveR[PLAYER_COUNT];
+    int32 playerBoundActiveL[PLAYER_COUNT];
+    int32 deathBounds[PLAYER_COUNT];
+    int32 playerBoundsB[PLAYER_COUNT];
+    int32 playerBoundsT[PLAYER_COUNT];
+    int32 playerBoundsR[PLAYER_COUNT];
+    int32 playerBoundsL[PLAYER_COUNT];
+    int32 cameraBoundsB[PLAYER_COUNT];
+    int32 cameraBoundsT[PLAYER_COUNT];
+    int32 cameraBoundsR[PLAYER_COUNT];
+    int32 cameraBoundsL[PLAYER_COUNT];
+    uint8 layerIDs[PLAYER_COUNT][LAYER_COUNT];
+
     for (int32 p = 0; p < Player->playerCount; ++p) {
         cameraBoundsL[p] = Zone->cameraBoundsL[p];
         cameraBoundsR[p] = Zone->cameraBoundsR[p];
@@ -1263,6 +1349,159 @@ void Zone_HandlePlayerSwap(void)
 #endif
 }
 
+#if MANIA_USE_PLUS
+void Zone_StoreSwapState(ZoneSwapState *swapState, EntityPlayer *player)
+{
+    int32 playerID = RSDK.GetEntitySlot(player);
+
+    swapState->state           = player->state;
+    swapState->nextAirState    = player->nextAirState;
+    swapState->nextGroundState = player->nextGroundState;
+    swapState->onGround        = player->onGround;
+    swapState->groundedStore   = player->groundedStore;
+    for (int32 i = 0; i < 8; ++i) {
+        swapState->abilityValues[i] = player->abilityValues[i];
+        swapState->abilityPtrs[i]   = player->abilityPtrs[i];
+    }
+    swapState->angle           = player->angle;
+    swapState->rotation        = player->rotation;
+    swapState->direction       = player->direction;
+    swapState->tileCollisions  = player->tileCollisions;
+    swapState->interaction     = player->interaction;
+    swapState->animationID     = player->animator.animationID;
+    swapState->position        = player->position;
+    swapState->velocity        = player->velocity;
+    swapState->groundVel       = player->groundVel;
+    swapState->shield          = player->shield;
+    swapState->collisionLayers = player->collisionLayers;
+    swapState->collisionPlane  = player->collisionPlane;
+    swapState->collisionMode   = player->collisionMode;
+    swapState->invincibleTimer = player->invincibleTimer;
+    swapState->speedShoesTimer = player->speedShoesTimer;
+    swapState->blinkTimer      = player->blinkTimer;
+    swapState->visible         = player->visible;
+
+    swapState->cameraBoundsL      = Zone->cameraBoundsL[playerID];
+    swapState->cameraBoundsR      = Zone->cameraBoundsR[playerID];
+    swapState->cameraBoundsT      = Zone->cameraBoundsT[playerID];
+    swapState->cameraBoundsB      = Zone->cameraBoundsB[playerID];
+    swapState->playerBoundsL      = Zone->playerBoundsL[playerID];
+    swapState->playerBoundsR      = Zone->playerBoundsR[playerID];
+    swapState->playerBoundsT      = Zone->playerBoundsT[playerID];
+    swapState->playerBoundsB      = Zone->playerBoundsB[playerID];
+    swapState->deathBoundary      = Zone->deathBoundary[playerID];
+    swapState->playerBoundActiveL = Zone->playerBoundActiveL[playerID];
+    swapState->playerBoundActiveR = Zone->playerBoundActiveR[playerID];
+    swapState->playerBoundActiveT = Zone->playerBoundActiveT[playerID];
+    swapState->playerBoundActiveB = Zone->playerBoundActiveB[playerID];
+
+    for (int32 l = 0; l < LAYER_COUNT; ++l) {
+        TileLayer *layer = RSDK.GetTileLayer(l);
+        if (layer)
+            swapState->layerDrawGroups[l] = layer->drawGroup[playerID];
+        else
+            swapState->layerDrawGroups[l] = DRAWGROUP_COUNT;
+    }
+}
+
+void Zone_RestoreSwapState(ZoneSwapState *swapState, EntityPlayer *player)
+{
+    int32 playerID = RSDK.GetEntitySlot(player);
+
+    void *state = swapState->state;
+    if (state == Player_State_Ground || state == Player_State_Air || state == Player_State_Roll || state == Player_State_TubeRoll
+        || state == Player_State_TubeAirRoll) {
+        player->state           = state;
+        player->nextAirState    = swapState->nextAirState;
+        player->nextGroundState = swapState->nextGroundState;
+        player->onGround        = swapState->onGround;
+        player->groundedStore   = swapState->groundedStore;
+        for (int32 i = 0; i < 8; ++i) {
+            player->abilityValues[i] = swapState->abilityValues[i];
+            player->abilityPtrs[i]   = swapState->abilityPtrs[i];
+        }
+        player->angle          = swapState->angle;
+        player->rotation       = swapState->rotation;
+        player->direction      = swapState->direction;
+        player->tileCollisions = swapState->tileCollisions;
+        player->interaction    = swapState->interaction;
+        RSDK.SetSpriteAnimation(player->aniFrames, swapState->animationID, &player->animator, false, 0);
+    }
+    else {
+        player->state = Player_State_Air;
+        RSDK.SetSpriteAnimation(player->aniFrames, ANI_JUMP, &player->animator, false, 0);
+        player->tileCollisions = TILECOLLISION_DOWN;
+        player->interaction    = true;
+    }
+
+    player->position        = swapState->position;
+    player->velocity        = swapState->velocity;
+    player->groundVel       = swapState->groundVel;
+    player->shield          = swapState->shield;
+    player->collisionLayers = swapState->collisionLayers;
+    player->collisionPlane  = swapState->collisionPlane;
+    player->collisionMode   = swapState->collisionMode;
+    player->invincibleTimer = swapState->invincibleTimer;
+    player->speedShoesTimer = swapState->speedShoesTimer;
+    player->blinkTimer      = swapState->blinkTimer;
+    player->visible         = swapState->visible;
+    Player_UpdatePhysicsState(player);
+
+    Zone->cameraBoundsL[playerID]      = swapState->cameraBoundsL;
+    Zone->cameraBoundsR[playerID]      = swapState->cameraBoundsR;
+    Zone->cameraBoundsT[playerID]      = swapState->cameraBoundsT;
+    Zone->cameraBoundsB[playerID]      = swapState->cameraBoundsB;
+    Zone->playerBoundsL[playerID]      = swapState->playerBoundsL;
+    Zone->playerBoundsR[playerID]      = swapState->playerBoundsR;
+    Zone->playerBoundsT[playerID]      = swapState->playerBoundsT;
+    Zone->playerBoundsB[playerID]      = swapState->playerBoundsB;
+    Zone->deathBoundary[playerID]      = swapState->deathBoundary;
+    Zone->playerBoundActiveL[playerID] = swapState->playerBoundActiveL;
+    Zone->playerBoundActiveR[playerID] = swapState->playerBoundActiveR;
+    Zone->playerBoundActiveT[playerID] = swapState->playerBoundActiveT;
+    Zone->playerBoundActiveB[playerID] = swapState->playerBoundActiveB;
+
+    for (int32 l = 0; l < LAYER_COUNT; ++l) {
+        TileLayer *layer = RSDK.GetTileLayer(l);
+        if (layer)
+            layer->drawGroup[playerID] = swapState->layerDrawGroups[l];
+    }
+}
+
+void Zone_PermuteEntities(Entity **entities, uint8 *srcIDs, uint8 *dstIDs, int32 count, size_t entitySize)
+{
+    // which id each id's new contents come from, anything not being swapped just maps to itself
+    uint8 sourceOf[PLAYER_COUNT];
+    bool32 moved[PLAYER_COUNT];
+    for (int32 i = 0; i < PLAYER_COUNT; ++i) {
+        sourceOf[i] = i;
+        moved[i]    = false;
+    }
+
+    for (int32 i = 0; i < count; ++i) sourceOf[dstIDs[i]] = srcIDs[i];
+
+    // walk each cycle of the permutation, only the first entity of a cycle ever needs to be set aside
+    EntityBase store;
+    for (int32 i = 0; i < count; ++i) {
+        int32 start = dstIDs[i];
+        if (moved[start] || sourceOf[start] == start)
+            continue;
+
+        memcpy(&store, entities[start], entitySize);
+
+        int32 id = start;
+        for (int32 c = 0; c < count && sourceOf[id] != start; ++c) {
+            memcpy(entities[id], entities[sourceOf[id]], entitySize);
+            moved[id] = true;
+            id        = sourceOf[id];
+        }
+
+        memcpy(entities[id], &store, entitySize);
+        moved[id] = true;
+    }
+}
+#endif
+
 void Zone_State_SwapPlayers(void)
 {
     RSDK_THIS(Zone);
@@ -1414,3 +1653,121 @@ void Zone_EditorLoad(void)
 #endif
 
 void Zone_Serialize(void) {}
+
+#if GAME_RECORD_ASSET_MANIFEST
+void Zone_StartAssetManifest(void)
+{
+    if (Zone->manifestRecording)
+        return;
+
+    Zone->manifestCount    = 0;
+    Zone->manifestRequests = 0;
+
+    Zone->manifestLoaders.LoadSpriteAnimation = RSDK.LoadSpriteAnimation;
+    Zone->manifestLoaders.LoadSpriteSheet     = RSDK.LoadSpriteSheet;
+    Zone->manifestLoaders.LoadMesh            = RSDK.LoadMesh;
+    Zone->manifestLoaders.GetSfx              = RSDK.GetSfx;
+
+    RSDK.LoadSpriteAnimation = Zone_Manifest_LoadSpriteAnimation;
+    RSDK.LoadSpriteSheet     = Zone_Manifest_LoadSpriteSheet;
+    RSDK.LoadMesh            = Zone_Manifest_LoadMesh;
+    RSDK.GetSfx              = Zone_Manifest_GetSfx;
+
+    Zone->manifestRecording = true;
+}
+
+void Zone_FinishAssetManifest(void)
+{
+    if (!Zone->manifestRecording)
+        return;
+
+    RSDK.LoadSpriteAnimation = Zone->manifestLoaders.LoadSpriteAnimation;
+    RSDK.LoadSpriteSheet     = Zone->manifestLoaders.LoadSpriteSheet;
+    RSDK.LoadMesh            = Zone->manifestLoaders.LoadMesh;
+    RSDK.GetSfx              = Zone->manifestLoaders.GetSfx;
+
+    Zone->manifestRecording = false;
+
+    char fileName[0x40];
+    snprintf(fileName, sizeof(fileName), "Manifests/Scene%d.bin", SceneInfo->listPos);
+    for (int32 i = 0; i < (int32)(sizeof(sceneFolderList) / sizeof(sceneFolderList[0])); ++i) {
+        if (sceneFolderList[i].tag == Zone->sceneFolders) {
+            snprintf(fileName, sizeof(fileName), "Manifests/%s.bin", sceneFolderList[i].folder);
+            break;
+        }
+    }
+
+    // Format: "MNF" signature, entry count (uint16), then {type, scope, path length, path} per entry
+    uint8 *buffer = Zone->manifestBuffer;
+    int32 pos     = 0;
+    buffer[pos++] = 'M';
+    buffer[pos++] = 'N';
+    buffer[pos++] = 'F';
+    buffer[pos++] = Zone->manifestCount & 0xFF;
+    buffer[pos++] = Zone->manifestCount >> 8;
+
+    for (int32 i = 0; i < Zone->manifestCount; ++i) {
+        ZoneManifestEntry *entry = &Zone->manifest[i];
+        int32 length             = (int32)strlen(entry->path);
+
+        buffer[pos++] = entry->type;
+        buffer[pos++] = entry->scope;
+        buffer[pos++] = length;
+        memcpy(&buffer[pos], entry->path, length);
+        pos += length;
+    }
+
+    RSDK.SaveUserFile(fileName, buffer, pos);
+    LogHelpers_Print("Asset manifest %s: %d assets, %d requests (%d cache hits)", fileName, Zone->manifestCount, Zone->manifestRequests,
+                     Zone->manifestRequests - Zone->manifestCount);
+}
+
+void Zone_RecordManifestAsset(uint8 type, uint8 scope, const char *path)
+{
+    if (!path)
+        return;
+
+    ++Zone->manifestRequests;
+
+    for (int32 i = 0; i < Zone->manifestCount; ++i) {
+        ZoneManifestEntry *entry = &Zone->manifest[i];
+        if (entry->type == type && !strcmp(entry->path, path)) {
+            ++entry->requests;
+            return;
+        }
+    }
+
+    if (Zone->manifestCount < ZONE_MANIFEST_ENTRY_COUNT) {
+        ZoneManifestEntry *entry = &Zone->manifest[Zone->manifestCount++];
+        entry->type              = type;
+        entry->scope             = scope;
+        entry->requests          = 1;
+        strncpy(entry->path, path, ZONE_MANIFEST_PATH_SIZE - 1);
+        entry->path[ZONE_MANIFEST_PATH_SIZE - 1] = 0;
+    }
+}
+
+uint16 Zone_Manifest_LoadSpriteAnimation(const char *filePath, uint8 scope)
+{
+    Zone_RecordManifestAsset(MANIFEST_SPRITEANIMATION, scope, filePath);
+    return Zone->manifestLoaders.LoadSpriteAnimation(filePath, scope);
+}
+
+uint16 Zone_Manifest_LoadSpriteSheet(const char *filePath, uint8 scope)
+{
+    Zone_RecordManifestAsset(MANIFEST_SPRITESHEET, scope, filePath);
+    return Zone->manifestLoaders.LoadSpriteSheet(filePath, scope);
+}
+
+uint16 Zone_Manifest_LoadMesh(const char *filename, uint8 scope)
+{
+    Zone_RecordManifestAsset(MANIFEST_MESH, scope, filename);
+    return Zone->manifestLoaders.LoadMesh(filename, scope);
+}
+
+uint16 Zone_Manifest_GetSfx(const char *path)
+{
+    Zone_RecordManifestAsset(MANIFEST_SFX, SCOPE_NONE, path);
+    return Zone->manifestLoaders.GetSfx(path);
+}
+#endif
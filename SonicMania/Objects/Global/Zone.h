@@ -10,12 +10,72 @@
 #define ZONE_RAND(min, max) RSDK.Rand(min, max)
 #endif
 
+// Use this for randomness that only affects visuals (debris, sparkles, shards, etc), anything that can affect gameplay should stay on RSDK.Rand
+#if MANIA_USE_PLUS && GAME_SPLIT_COSMETIC_RAND
+#define COSMETIC_RAND(min, max) RSDK.RandSeeded(min, max, &Zone->cosmeticRandSeed)
+#else
+#define COSMETIC_RAND(min, max) RSDK.Rand(min, max)
+#endif
+
 #define Zone_AddVSSwapCallback(callback)                                                                                                             \
     if (Zone->vsSwapCBCount < 0x10) {                                                                                                                \
         Zone->vsSwapCB[Zone->vsSwapCBCount] = callback;                                                                                              \
         ++Zone->vsSwapCBCount;                                                                                                                       \
     }
 
+// Zone->entityStorage layout, each stored entity type gets a block of PLAYER_COUNT slots
+#define ZONE_STORAGE_PLAYER(playerID)     (playerID)
+#define ZONE_STORAGE_SHIELD(playerID)     ((1 * PLAYER_COUNT) + (playerID))
+#define ZONE_STORAGE_CAMERA(playerID)     ((2 * PLAYER_COUNT) + (playerID))
+#define ZONE_STORAGE_IMAGETRAIL(playerID) ((3 * PLAYER_COUNT) + (playerID))
+#define ZONE_STORAGE_COUNT                (4 * PLAYER_COUNT)
+
+#if MANIA_USE_PLUS
+// Everything that moves with a player when positions get swapped
+// The player entities themselves stay put (along with their character & inputs), only this gets exchanged
+typedef struct {
+    StateMachine(state);
+    StateMachine(nextAirState);
+    StateMachine(nextGroundState);
+    bool32 onGround;
+    bool32 groundedStore;
+    int32 abilityValues[8];
+    void *abilityPtrs[8];
+    int32 angle;
+    int32 rotation;
+    uint8 direction;
+    int32 tileCollisions;
+    bool32 interaction;
+    uint16 animationID;
+    Vector2 position;
+    Vector2 velocity;
+    int32 groundVel;
+    int32 shield;
+    uint8 collisionLayers;
+    uint8 collisionPlane;
+    uint8 collisionMode;
+    int32 invincibleTimer;
+    int32 speedShoesTimer;
+    int32 blinkTimer;
+    uint8 visible;
+
+    int32 cameraBoundsL;
+    int32 cameraBoundsR;
+    int32 cameraBoundsT;
+    int32 cameraBoundsB;
+    int32 playerBoundsL;
+    int32 playerBoundsR;
+    int32 playerBoundsT;
+    int32 playerBoundsB;
+    int32 deathBoundary;
+    int32 playerBoundActiveL;
+    int32 playerBoundActiveR;
+    int32 playerBoundActiveT;
+    int32 playerBoundActiveB;
+    uint8 layerDrawGroups[LAYER_COUNT];
+} ZoneSwapState;
+#endif
+
 typedef enum {
     ZONE_INVALID = -1,
     ZONE_GHZ,
@@ -40,6 +100,74 @@ typedef enum {
     ZONE_COUNT_SAVEFILE = ZONE_ERZ + 1,
 } ZoneIDs;
 
+// Folder tags for Zone->sceneFolders, one bit per scene folder that gets checked outside of StageLoad
+typedef enum {
+    SCENEFOLDER_GHZ         = 1 << 0,
+    SCENEFOLDER_GHZCUTSCENE = 1 << 1,
+    SCENEFOLDER_CPZ         = 1 << 2,
+    SCENEFOLDER_SPZ1        = 1 << 3,
+    SCENEFOLDER_SPZ2        = 1 << 4,
+    SCENEFOLDER_FBZ         = 1 << 5,
+    SCENEFOLDER_PSZ1        = 1 << 6,
+    SCENEFOLDER_PSZ2        = 1 << 7,
+    SCENEFOLDER_SSZ1        = 1 << 8,
+    SCENEFOLDER_SSZ2        = 1 << 9,
+    SCENEFOLDER_HCZ         = 1 << 10,
+    SCENEFOLDER_MSZ         = 1 << 11,
+    SCENEFOLDER_MSZCUTSCENE = 1 << 12,
+    SCENEFOLDER_OOZ1        = 1 << 13,
+    SCENEFOLDER_OOZ2        = 1 << 14,
+    SCENEFOLDER_LRZ1        = 1 << 15,
+    SCENEFOLDER_LRZ2        = 1 << 16,
+    SCENEFOLDER_LRZ3        = 1 << 17,
+    SCENEFOLDER_MMZ         = 1 << 18,
+    SCENEFOLDER_TMZ1        = 1 << 19,
+    SCENEFOLDER_TMZ2        = 1 << 20,
+    SCENEFOLDER_TMZ3        = 1 << 21,
+    SCENEFOLDER_ERZ         = 1 << 22,
+    SCENEFOLDER_AIZ         = 1 << 23,
+    SCENEFOLDER_HPZ         = 1 << 24,
+    SCENEFOLDER_BLUEPRINT   = 1 << 25,
+    SCENEFOLDER_PUYO        = 1 << 26,
+} SceneFolderTags;
+
+typedef struct {
+    const char *folder;
+    uint32 tag;
+    int32 zoneID;
+} ZoneSceneFolder;
+
+#if GAME_RECORD_ASSET_MANIFEST
+#define ZONE_MANIFEST_ENTRY_COUNT (0x400)
+#define ZONE_MANIFEST_PATH_SIZE   (0x40)
+
+typedef enum {
+    MANIFEST_SPRITEANIMATION,
+    MANIFEST_SPRITESHEET,
+    MANIFEST_MESH,
+    MANIFEST_SFX,
+} ManifestAssetTypes;
+
+typedef struct {
+    uint8 type;
+    uint8 scope;
+    uint16 requests; // how many times StageLoad asked for this asset, anything past the first is a cache hit
+    char path[ZONE_MANIFEST_PATH_SIZE];
+} ZoneManifestEntry;
+
+typedef struct {
+    uint16 (*LoadSpriteAnimation)(const char *filePath, uint8 scope);
+    uint16 (*LoadSpriteSheet)(const char *filePath, uint8 scope);
+    uint16 (*LoadMesh)(const char *filename, uint8 scope);
+    uint16 (*GetSfx)(const char *path);
+} ZoneManifestLoaders;
+#endif
+
+// Checks against the scene identity resolved in Zone_StageLoad, use these instead of RSDK.CheckSceneFolder outside of StageLoad
+// (only valid in scenes that have a Zone object)
+#define Zone_IsScene(zone)          (Zone->sceneZoneID == (zone))
+#define Zone_IsSceneFolder(folders) ((Zone->sceneFolders & (folders)) != 0)
+
 // Object Class
 struct ObjectZone {
     RSDK_OBJECT
@@ -93,12 +221,34 @@ struct ObjectZone {
     uint8 hudDrawGroup;
     uint16 sfxFail;
 #if MANIA_USE_PLUS
-    EntityBase entityStorage[16];
+    EntityBase entityStorage[ZONE_STORAGE_COUNT];
     int32 screenPosX[PLAYER_COUNT];
     int32 screenPosY[PLAYER_COUNT];
     bool32 swapGameMode;
     bool32 teleportActionActive;
     int32 randSeed;
+#endif
+    // resolved in StageLoad, the engine's layers don't move so these stay valid for the whole stage
+    TileLayer *fgTileLayer[2]; // { lowPriority, highPriority }
+    TileLayer *moveTileLayer;
+    int32 tempEntityCount;            // live temp entities, counted every frame in StaticUpdate & again whenever a create has to search for a slot
+    int32 tempEntityHighWater;        // most temp entities seen alive at once this stage (as of those counts)
+    int32 tempOverflowCount;          // creates that found no free temp slot
+    uint16 tempOverflows[TYPE_COUNT]; // tempOverflowCount, but per class that tried to create an entity
+    int32 sceneZoneID;                // Zone_GetZoneID() for the loaded scene
+    uint32 sceneFolders;              // SCENEFOLDER_XXX tag of the loaded scene's folder, 0 if it isn't in the table
+    bool32 sceneEncore;               // the loaded scene is being played in encore mode
+    int32 sceneListID;                // SceneInfo->listPos + 1 of the scene the identity was resolved for, 0 if unresolved
+#if MANIA_USE_PLUS && GAME_SPLIT_COSMETIC_RAND
+    int32 cosmeticRandSeed;
+#endif
+#if GAME_RECORD_ASSET_MANIFEST
+    bool32 manifestRecording;
+    int32 manifestCount;
+    int32 manifestRequests;
+    ZoneManifestLoaders manifestLoaders; // the engine's loaders, restored once recording stops
+    ZoneManifestEntry manifest[ZONE_MANIFEST_ENTRY_COUNT];
+    uint8 manifestBuffer[5 + ZONE_MANIFEST_ENTRY_COUNT * (3 + ZONE_MANIFEST_PATH_SIZE)];
 #endif
 };
 
@@ -131,6 +281,8 @@ void Zone_Serialize(void);
 
 // Extra Entity Functions
 int32 Zone_GetZoneID(void);
+// Resolves the zone ID, folder tag & encore flag for the loaded scene (only needs to be called once per stage)
+void Zone_ResolveSceneIdentity(void);
 // Stores entities (in preparation for an act transition)
 void Zone_StoreEntities(int32 xOffset, int32 yOffset);
 // Reloads stored entities (used after an act transition)
@@ -149,6 +301,13 @@ void Zone_ReloadScene(int32 screen);
 void Zone_StartTeleportAction(void);
 void Zone_HandlePlayerBounds(void);
 void Zone_ApplyWorldBounds(void);
+// CREATE_ENTITY goes through this, if the next temp slot is still in use it'll try to find a free one (or a cosmetic one to overwrite) instead
+Entity *Zone_CreateTempEntity(uint16 classID, void *data, int32 x, int32 y);
+void Zone_FindFreeTempSlot(uint16 classID);
+// Cosmetic entities (debris, dust, explosions) are the first to go when the temp range is full
+bool32 Zone_IsCosmeticClass(uint16 classID);
+// checks if 'position' (+/- 'range') overlaps the screen currently being drawn, used to skip draws for other split-screen views
+bool32 Zone_CheckPosOnCurrentScreen(Vector2 *position, Vector2 *range);
 
 bool32 Zone_IsZoneLastAct(void);
 #if MANIA_USE_PLUS
@@ -169,7 +328,25 @@ void Zone_State_ReloadScene(void);
 #endif
 void Zone_State_FadeOut_Destroy(void);
 void Zone_HandlePlayerSwap(void);
+#if MANIA_USE_PLUS
+void Zone_StoreSwapState(ZoneSwapState *swapState, EntityPlayer *player);
+void Zone_RestoreSwapState(ZoneSwapState *swapState, EntityPlayer *player);
+// Moves the contents of 'entities[srcIDs[i]]' into 'entities[dstIDs[i]]', 'dstIDs' must be a permutation of 'srcIDs'
+void Zone_PermuteEntities(Entity **entities, uint8 *srcIDs, uint8 *dstIDs, int32 count, size_t entitySize);
+#endif
 void Zone_State_SwapPlayers(void);
 void Zone_State_HandleSwapFadeIn(void);
 
+#if GAME_RECORD_ASSET_MANIFEST
+// Swaps the asset loaders in the RSDK function table for recording ones (any StageLoad that runs after Zone's gets recorded)
+void Zone_StartAssetManifest(void);
+// Restores the engine's loaders & writes the recorded manifest out
+void Zone_FinishAssetManifest(void);
+void Zone_RecordManifestAsset(uint8 type, uint8 scope, const char *path);
+uint16 Zone_Manifest_LoadSpriteAnimation(const char *filePath, uint8 scope);
+uint16 Zone_Manifest_LoadSpriteSheet(const char *filePath, uint8 scope);
+uint16 Zone_Manifest_LoadMesh(const char *filename, uint8 scope);
+uint16 Zone_Manifest_GetSfx(const char *path);
+#endif
+
 #endif //! OBJ_ZONE_H
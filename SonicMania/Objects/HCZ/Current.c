@@ -326,7 +326,7 @@ void Current_State_WaterLeft(void)
 
                         int32 x = self->position.x + ((self->hitbox.right - 32) << 16);
                         self->activePlayers &= ~(1 << playerID);
-                        if (RSDK.CheckSceneFolder("FBZ") && !player->sidekick && self->fbzAchievement && self->playerPositions[playerID].x >= x
+                        if (Zone_IsSceneFolder(SCENEFOLDER_FBZ) && !player->sidekick && self->fbzAchievement && self->playerPositions[playerID].x >= x
                             && player->position.x < self->position.x) {
                             API_UnlockAchievement(&achievementList[ACH_FBZ]);
                         }
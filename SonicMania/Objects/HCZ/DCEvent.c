@@ -119,7 +119,7 @@ void DCEvent_State_Collapse(void)
 {
     RSDK_THIS(DCEvent);
 
-    TileLayer *move = RSDK.GetTileLayer(Zone->moveLayer);
+    TileLayer *move = Zone->moveTileLayer;
     move->scrollPos -= 0x8000;
 
     foreach_active(Player, player)
@@ -168,7 +168,7 @@ void DCEvent_StateEggmanBomber_AwaitPlayer(void)
         Music_TransitionTrack(TRACK_MINIBOSS, 0.0125);
         RSDK.SetSpriteAnimation(DCEvent->aniFrames, 1, &self->animator, true, 0);
 
-        TileLayer *moveLayer    = RSDK.GetTileLayer(Zone->moveLayer);
+        TileLayer *moveLayer    = Zone->moveTileLayer;
         moveLayer->drawGroup[0] = 6;
 
         self->position.x -= 0x1000000;
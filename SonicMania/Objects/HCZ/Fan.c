@@ -133,7 +133,7 @@ void Fan_StaticUpdate(void)
         }
     }
 
-    if (RSDK.CheckSceneFolder("HCZ")) {
+    if (Zone_IsSceneFolder(SCENEFOLDER_HCZ)) {
         int32 count = 0;
 
         if (RSDK_GET_ENTITY(SLOT_PAUSEMENU, PauseMenu)->classID != PauseMenu->classID) {
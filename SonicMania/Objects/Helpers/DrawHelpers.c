@@ -151,6 +151,101 @@ void DrawHelpers_DrawArenaBounds(int32 left, int32 top, int32 right, int32 botto
     }
 }
 
+void DrawHelpers_DrawSpriteStrip(Animator *animator, Vector2 *start, Vector2 *step, int32 count, bool32 screenRelative)
+{
+    if (!animator->frames || count <= 0)
+        return;
+
+    int32 first = 0;
+    int32 last  = count - 1;
+
+    // rotated/scaled sprites can reach anywhere, so only cull frames that are drawn as-is (or flipped)
+    if (!(SceneInfo->entity->drawFX & (FX_ROTATE | FX_SCALE))) {
+        RSDKScreenInfo *screen = &ScreenInfo[SceneInfo->currentScreenID];
+        SpriteFrame *frame     = (SpriteFrame *)animator->frames + animator->frameID;
+
+        int32 startPos[2] = { start->x, start->y };
+        int32 stepSize[2] = { step->x, step->y };
+        int32 extent[2]   = { MAX(abs(frame->pivotX), abs(frame->pivotX + frame->width)) + 1,
+                              MAX(abs(frame->pivotY), abs(frame->pivotY + frame->height)) + 1 };
+        int32 screenPos[2]  = { screenRelative ? 0 : screen->position.x, screenRelative ? 0 : screen->position.y };
+        int32 screenSize[2] = { screen->size.x, screen->size.y };
+
+        for (int32 axis = 0; axis < 2; ++axis) {
+            // the range of positions where a copy overlaps the screen on this axis
+            int32 min = (screenPos[axis] - extent[axis]) << 16;
+            int32 max = (screenPos[axis] + screenSize[axis] + extent[axis]) << 16;
+
+            if (!stepSize[axis]) {
+                if (startPos[axis] < min || startPos[axis] > max)
+                    return;
+            }
+            else {
+                int32 lo = (stepSize[axis] > 0 ? min : max) - startPos[axis];
+                int32 hi = (stepSize[axis] > 0 ? max : min) - startPos[axis];
+
+                // first = ceil(lo / step), last = floor(hi / step)
+                int32 firstID = lo / stepSize[axis];
+                if (lo % stepSize[axis] && (lo < 0) == (stepSize[axis] < 0))
+                    ++firstID;
+
+                int32 lastID = hi / stepSize[axis];
+                if (hi % stepSize[axis] && (hi < 0) != (stepSize[axis] < 0))
+                    --lastID;
+
+                first = MAX(first, firstID);
+                last  = MIN(last, lastID);
+            }
+        }
+    }
+
+    Vector2 drawPos;
+    drawPos.x = start->x + first * step->x;
+    drawPos.y = start->y + first * step->y;
+    for (int32 i = first; i <= last; ++i) {
+        RSDK.DrawSprite(animator, &drawPos, screenRelative);
+
+        drawPos.x += step->x;
+        drawPos.y += step->y;
+    }
+}
+
+void DrawHelpers_SetupPeriodicScanlines(PeriodicScanlines *table, ScanlineInfo *period, int32 length, int32 wrapOffsetX, int32 wrapOffsetY)
+{
+    table->length       = length;
+    table->wrapOffset.x = wrapOffsetX;
+    table->wrapOffset.y = wrapOffsetY;
+
+    memcpy(table->lines, period, length * sizeof(ScanlineInfo));
+    memcpy(&table->lines[length], period, length * sizeof(ScanlineInfo));
+
+    for (int32 i = length; i < 2 * length; ++i) {
+        table->lines[i].position.x += wrapOffsetX;
+        table->lines[i].position.y += wrapOffsetY;
+    }
+}
+
+void DrawHelpers_DrawPeriodicScanlines(PeriodicScanlines *table, ScanlineInfo *scanlines, int32 phase, int32 lineCount, int32 offsetX, int32 offsetY)
+{
+    phase &= table->length - 1;
+
+    while (lineCount > 0) {
+        int32 count = MIN(lineCount, table->length);
+
+        memcpy(scanlines, &table->lines[phase], count * sizeof(ScanlineInfo));
+        for (int32 i = 0; i < count; ++i) {
+            scanlines[i].position.x += offsetX;
+            scanlines[i].position.y += offsetY;
+        }
+
+        // anything past a full period picks up from the same phase, just one wrap further along
+        scanlines += count;
+        lineCount -= count;
+        offsetX += table->wrapOffset.x;
+        offsetY += table->wrapOffset.y;
+    }
+}
+
 #if GAME_INCLUDE_EDITOR
 void DrawHelpers_EditorDraw(void) {}
 
@@ -3,6 +3,14 @@
 
 #include "Game.h"
 
+// A scanline deformation that repeats every 'length' lines (power of 2, up to 0x100)
+// The period is stored twice over so any phase can be copied out as one block, with 'wrapOffset' added to the positions of the 2nd copy
+typedef struct {
+    ScanlineInfo lines[0x200];
+    int32 length;
+    Vector2 wrapOffset;
+} PeriodicScanlines;
+
 // Object Class
 struct ObjectDrawHelpers {
     RSDK_OBJECT
@@ -35,6 +43,14 @@ void DrawHelpers_DrawArrowAdditive(int32 x1, int32 y1, int32 x2, int32 y2, uint3
 void DrawHelpers_DrawIsocelesTriangle(int32 x1, int32 y1, int32 x2, int32 y2, int32 edgeSize, uint32 color, uint32 inkEffect, uint32 alpha);
 void DrawHelpers_DrawCross(int32 x, int32 y, int32 sizeX, int32 sizeY, uint32 color);
 
+// Draws 'count' copies of the animator's current frame, starting at 'start' and moving by 'step' each time
+// Only the copies that can be seen on the current screen are drawn
+void DrawHelpers_DrawSpriteStrip(Animator *animator, Vector2 *start, Vector2 *step, int32 count, bool32 screenRelative);
+
+void DrawHelpers_SetupPeriodicScanlines(PeriodicScanlines *table, ScanlineInfo *period, int32 length, int32 wrapOffsetX, int32 wrapOffsetY);
+// Fills 'lineCount' scanlines starting from 'phase' in the table, offsetting each line's position by 'offsetX'/'offsetY'
+void DrawHelpers_DrawPeriodicScanlines(PeriodicScanlines *table, ScanlineInfo *scanlines, int32 phase, int32 lineCount, int32 offsetX, int32 offsetY);
+
 // Custom Helpers I added for editor stuff
 void DrawHelpers_DrawArrow(int32 x1, int32 y1, int32 x2, int32 y2, uint32 color, uint32 inkEffect, uint32 alpha);
 void DrawHelpers_DrawRectOutline(int32 x, int32 y, int32 sizeX, int32 sizeY, uint32 color);
@@ -9,6 +9,22 @@
 
 ObjectMathHelpers *MathHelpers = NULL;
 
+// ceil(sqrt((i + 0x41) << 8)), used to seed MathHelpers_SquareRoot from the top 8 bits of a normalized 16-bit value
+static const uint16 squareRootTable[0xC0] = {
+    0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x90,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9C, 0x9D,
+    0x9E, 0x9F, 0xA0, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA8, 0xA9, 0xAA,
+    0xAB, 0xAB, 0xAC, 0xAD, 0xAE, 0xAE, 0xAF, 0xB0, 0xB0, 0xB1, 0xB2, 0xB3, 0xB3, 0xB4, 0xB5, 0xB6,
+    0xB6, 0xB7, 0xB8, 0xB8, 0xB9, 0xBA, 0xBA, 0xBB, 0xBC, 0xBC, 0xBD, 0xBE, 0xBE, 0xBF, 0xC0, 0xC0,
+    0xC1, 0xC2, 0xC2, 0xC3, 0xC4, 0xC4, 0xC5, 0xC6, 0xC6, 0xC7, 0xC8, 0xC8, 0xC9, 0xCA, 0xCA, 0xCB,
+    0xCC, 0xCC, 0xCD, 0xCD, 0xCE, 0xCF, 0xCF, 0xD0, 0xD0, 0xD1, 0xD2, 0xD2, 0xD3, 0xD4, 0xD4, 0xD5,
+    0xD5, 0xD6, 0xD7, 0xD7, 0xD8, 0xD8, 0xD9, 0xDA, 0xDA, 0xDB, 0xDB, 0xDC, 0xDC, 0xDD, 0xDE, 0xDE,
+    0xDF, 0xDF, 0xE0, 0xE0, 0xE1, 0xE2, 0xE2, 0xE3, 0xE3, 0xE4, 0xE4, 0xE5, 0xE6, 0xE6, 0xE7, 0xE7,
+    0xE8, 0xE8, 0xE9, 0xE9, 0xEA, 0xEB, 0xEB, 0xEC, 0xEC, 0xED, 0xED, 0xEE, 0xEE, 0xEF, 0xEF, 0xF0,
+    0xF0, 0xF1, 0xF2, 0xF2, 0xF3, 0xF3, 0xF4, 0xF4, 0xF5, 0xF5, 0xF6, 0xF6, 0xF7, 0xF7, 0xF8, 0xF8,
+    0xF9, 0xF9, 0xFA, 0xFA, 0xFB, 0xFB, 0xFC, 0xFC, 0xFD, 0xFD, 0xFE, 0xFE, 0xFF, 0xFF, 0x100, 0x100,
+};
+
 void MathHelpers_Update(void) {}
 
 void MathHelpers_LateUpdate(void) {}
@@ -64,7 +80,7 @@ void MathHelpers_LerpSin1024(Vector2 *pos, int32 percent, int32 startX, int32 st
         pos->y = endY;
     }
     else {
-        int32 lerpPercent = (RSDK.Sin1024(percent + 0x300) >> 2) + 0x100;
+        int32 lerpPercent = (SIN1024(percent + 0x300) >> 2) + 0x100;
         pos->x            = startX + lerpPercent * ((endX - startX) >> 8);
         pos->y            = startY + lerpPercent * ((endY - startY) >> 8);
     }
@@ -81,7 +97,7 @@ void MathHelpers_Lerp2Sin1024(Vector2 *pos, int32 percent, int32 startX, int32 s
         pos->y = endY;
     }
     else {
-        int32 lerpPercent = RSDK.Sin1024(percent) >> 2;
+        int32 lerpPercent = SIN1024(percent) >> 2;
         pos->x            = startX + lerpPercent * ((endX - startX) >> 8);
         pos->y            = startY + lerpPercent * ((endY - startY) >> 8);
     }
@@ -98,7 +114,7 @@ void MathHelpers_LerpSin512(Vector2 *pos, int32 percent, int32 startX, int32 sta
         pos->y = endY;
     }
     else {
-        int32 lerpPercent = (RSDK.Sin512(percent + 0x180) >> 2) + 0x80;
+        int32 lerpPercent = (SIN512(percent + 0x180) >> 2) + 0x80;
         pos->x            = startX + lerpPercent * ((endX - startX) >> 8);
         pos->y            = startY + lerpPercent * ((endY - startY) >> 8);
     }
@@ -122,21 +138,52 @@ Vector2 MathHelpers_GetBezierPoint(int32 percent, int32 x1, int32 y1, int32 x2,
 
 int32 MathHelpers_SquareRoot(uint32 num)
 {
-    int32 rem = 1 << 30; // 1 << 31 would result in the value having to be unsigned, so this is the max
-    while (rem > num) rem >>= 2;
+    // this used to be a bit-by-bit shift/subtract loop, the table seed + 2 newton steps gives the exact same results for every input
+    if (!num)
+        return 0;
 
-    uint32 root = 0;
-    while (rem) {
-        if (num >= rem + root) {
-            num -= rem + root;
-            root += rem << 1;
-        }
+    uint32 n  = num;
+    int32 log = 0;
+    if (n >> 16) {
+        n >>= 16;
+        log += 16;
+    }
+    if (n >> 8) {
+        n >>= 8;
+        log += 8;
+    }
+    if (n >> 4) {
+        n >>= 4;
+        log += 4;
+    }
+    if (n >> 2) {
+        n >>= 2;
+        log += 2;
+    }
+    if (n >> 1)
+        log += 1;
 
-        rem >>= 2;
-        root >>= 1;
+    // shift num (by an even amount) so it sits in [0x4000, 0xFFFF], the seed is always >= the real root
+    int32 shift = (log - 14) & ~1;
+    uint32 root = 0;
+    if (shift >= 0) {
+        root = squareRootTable[(num >> shift >> 8) - 0x40] << (shift >> 1);
     }
+    else {
+        shift = -shift;
+        root  = (squareRootTable[((num << shift) >> 8) - 0x40] + (1 << (shift >> 1)) - 1) >> (shift >> 1);
+    }
+
+    root = (root + num / root) >> 1;
+    root = (root + num / root) >> 1;
+    if (root > 0xFFFF)
+        root = 0xFFFF;
+    if (root * root > num)
+        --root;
 
-    return num <= root ? root : (root + 1);
+    // round to the nearest root, same as before
+    uint32 remainder = num - root * root;
+    return remainder <= root ? root : (root + 1);
 }
 
 int32 MathHelpers_Distance(int32 x1, int32 y1, int32 x2, int32 y2)
@@ -147,6 +194,35 @@ int32 MathHelpers_Distance(int32 x1, int32 y1, int32 x2, int32 y2)
     return (MathHelpers_SquareRoot(distanceX * distanceX + distanceY * distanceY) << 16);
 }
 
+void MathHelpers_DistanceBatch(int32 x, int32 y, Vector2 *positions, int32 *distances, int32 count)
+{
+    for (int32 i = 0; i < count; ++i) {
+        int32 distanceX = abs(positions[i].x - x) >> 16;
+        int32 distanceY = abs(positions[i].y - y) >> 16;
+
+        distances[i] = MathHelpers_SquareRoot(distanceX * distanceX + distanceY * distanceY) << 16;
+    }
+}
+
+int32 MathHelpers_NearestOf(int32 x, int32 y, Vector2 *positions, int32 count)
+{
+    // the root is monotonic, so comparing the squared distances picks the same entry MathHelpers_Distance would
+    int32 nearest      = -1;
+    uint32 nearestDist = 0xFFFFFFFF;
+    for (int32 i = 0; i < count; ++i) {
+        int32 distanceX = abs(positions[i].x - x) >> 16;
+        int32 distanceY = abs(positions[i].y - y) >> 16;
+        uint32 dist     = distanceX * distanceX + distanceY * distanceY;
+
+        if (dist < nearestDist) {
+            nearest     = i;
+            nearestDist = dist;
+        }
+    }
+
+    return nearest;
+}
+
 int32 MathHelpers_GetBezierCurveLength(int32 x1, int32 y1, int32 x2, int32 y2, int32 x3, int32 y3, int32 x4, int32 y4)
 {
     int32 lastX = x1;
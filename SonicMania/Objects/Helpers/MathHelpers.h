@@ -42,6 +42,10 @@ void MathHelpers_LerpSin512(Vector2 *pos, int32 percent, int32 startX, int32 sta
 Vector2 MathHelpers_GetBezierPoint(int32 percent, int32 x1, int32 y1, int32 x2, int32 y2, int32 x3, int32 y3, int32 x4, int32 y4);
 int32 MathHelpers_SquareRoot(uint32 num);
 int32 MathHelpers_Distance(int32 x1, int32 y1, int32 x2, int32 y2);
+// fills "distances" with MathHelpers_Distance from (x, y) to each position
+void MathHelpers_DistanceBatch(int32 x, int32 y, Vector2 *positions, int32 *distances, int32 count);
+// returns the index of the position closest to (x, y), or -1 if count is 0
+int32 MathHelpers_NearestOf(int32 x, int32 y, Vector2 *positions, int32 count);
 int32 MathHelpers_GetBezierCurveLength(int32 x1, int32 y1, int32 x2, int32 y2, int32 x3, int32 y3, int32 x4, int32 y4);
 
 // "Collisions"
@@ -59,6 +59,82 @@ void ParticleHelpers_SetupParticleFX(void *debrisState, void (*callback)(EntityD
         callback(debris);
 }
 
+void ParticleHelpers_InitAmbientParticles(AmbientParticles *particles, int32 capacity)
+{
+    memset(particles, 0, sizeof(AmbientParticles));
+    particles->capacity = CLAMP(capacity, 0, AMBIENTPARTICLE_COUNT);
+}
+
+int32 ParticleHelpers_SpawnAmbientParticle(AmbientParticles *particles)
+{
+    for (int32 w = 0; w < AMBIENTPARTICLE_COUNT / 32; ++w) {
+        uint32 freeMask = ~particles->activeMask[w];
+        if (!freeMask)
+            continue;
+
+        int32 slot = w * 32;
+        while (!(freeMask & 1)) {
+            freeMask >>= 1;
+            ++slot;
+        }
+
+        if (slot >= particles->capacity)
+            return -1;
+
+        particles->activeMask[w] |= 1u << (slot & 31);
+        return slot;
+    }
+
+    return -1;
+}
+
+void ParticleHelpers_RemoveAmbientParticle(AmbientParticles *particles, int32 slot)
+{
+    particles->activeMask[slot >> 5] &= ~(1u << (slot & 31));
+    particles->positions[slot].x = 0;
+    particles->positions[slot].y = 0;
+}
+
+int32 ParticleHelpers_NextAmbientParticle(AmbientParticles *particles, int32 slot)
+{
+    ++slot;
+
+    for (int32 w = slot >> 5; w < AMBIENTPARTICLE_COUNT / 32; ++w) {
+        // skip whole words of empty slots at once
+        uint32 mask = particles->activeMask[w];
+        if (w == slot >> 5)
+            mask &= ~0u << (slot & 31);
+
+        if (mask) {
+            slot = w * 32;
+            while (!(mask & 1)) {
+                mask >>= 1;
+                ++slot;
+            }
+            return slot;
+        }
+    }
+
+    return -1;
+}
+
+void ParticleHelpers_StepAmbientParticles(AmbientParticles *particles, int32 swayShift, int32 velocityY)
+{
+    for (int32 w = 0; w < AMBIENTPARTICLE_COUNT / 32; ++w) {
+        uint32 mask = particles->activeMask[w];
+        if (!mask)
+            continue;
+
+        for (int32 i = w * 32; mask; ++i, mask >>= 1) {
+            if (mask & 1) {
+                particles->positions[i].x += RSDK.Sin256(particles->angles[i]) << swayShift;
+                particles->positions[i].y += velocityY;
+                particles->angles[i] = (particles->angles[i] + 1) & 0xFF;
+            }
+        }
+    }
+}
+
 #if GAME_INCLUDE_EDITOR
 void ParticleHelpers_EditorDraw(void) {}
 
@@ -3,6 +3,24 @@
 
 #include "Game.h"
 
+// Max ambient particles per list, must be a multiple of 32
+// Keep in mind lists stored in an entity are limited by the entity size
+#ifndef AMBIENTPARTICLE_COUNT
+#define AMBIENTPARTICLE_COUNT (0x40)
+#endif
+
+// Structure-of-arrays storage for ambient particles (snow, dust, embers, etc)
+// Slots are handed out lowest-first so the draw order is the same as a linear search for an empty slot would give
+typedef struct {
+    Vector2 positions[AMBIENTPARTICLE_COUNT];
+    uint16 frameIDs[AMBIENTPARTICLE_COUNT];
+    uint16 angles[AMBIENTPARTICLE_COUNT];
+    uint8 animIDs[AMBIENTPARTICLE_COUNT];
+    uint8 layers[AMBIENTPARTICLE_COUNT];
+    uint32 activeMask[AMBIENTPARTICLE_COUNT / 32];
+    int32 capacity;
+} AmbientParticles;
+
 // Object Class
 struct ObjectParticleHelpers {
     RSDK_OBJECT
@@ -34,4 +52,13 @@ void ParticleHelpers_SetupFallingParticles(int32 x, int32 y, void (*callback)(En
 void ParticleHelpers_SetupParticleFX(void *debrisState, void (*callback)(EntityDebris *), int32 speed, int32 xOffset, int32 yOffset, int32 maxX,
                                      int32 maxY);
 
+void ParticleHelpers_InitAmbientParticles(AmbientParticles *particles, int32 capacity);
+// Claims the lowest free slot & returns it, or -1 if the list is full
+int32 ParticleHelpers_SpawnAmbientParticle(AmbientParticles *particles);
+void ParticleHelpers_RemoveAmbientParticle(AmbientParticles *particles, int32 slot);
+// Returns the next active slot after 'slot' (pass -1 to get the first one), or -1 if there are no more
+int32 ParticleHelpers_NextAmbientParticle(AmbientParticles *particles, int32 slot);
+// Moves every active particle down by 'velocityY' & sideways by (Sin256(angle) << swayShift), then advances its angle
+void ParticleHelpers_StepAmbientParticles(AmbientParticles *particles, int32 swayShift, int32 velocityY);
+
 #endif //! OBJ_PARTICLEHELPERS_H
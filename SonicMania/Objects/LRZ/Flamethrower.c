@@ -345,7 +345,7 @@ void Flamethrower_State_EmittingFlames(void)
         EntityFlamethrower *flame = CREATE_ENTITY(Flamethrower, self, self->position.x, self->position.y);
         flame->active             = ACTIVE_NORMAL;
         flame->visible            = true;
-        if (RSDK.CheckSceneFolder("LRZ3"))
+        if (Zone_IsSceneFolder(SCENEFOLDER_LRZ3))
             flame->drawGroup = Zone->objectDrawGroup[0] - 1;
         else
             flame->drawGroup = Zone->objectDrawGroup[0];
@@ -392,7 +392,7 @@ void Flamethrower_State_SetupFireball(void)
         case FLAMETHROWER_ORIENTATION_UP: self->direction = MANIA_USE_PLUS ? FLIP_Y : FLIP_NONE; break;
     }
 
-    if (RSDK.CheckSceneFolder("LRZ3"))
+    if (Zone_IsSceneFolder(SCENEFOLDER_LRZ3))
         self->drawGroup = Zone->objectDrawGroup[0] - 1;
     else
         self->drawGroup = Zone->objectDrawGroup[0];
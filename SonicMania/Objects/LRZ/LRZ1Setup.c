@@ -26,14 +26,14 @@ void LRZ1Setup_StaticUpdate(void)
     }
 
     if (LRZ1Setup->fadeTimer <= 0) {
-        int32 blend = RSDK.Cos1024(2 * (Zone->timer & 0x1FF)) >> 3;
-        RSDK.SetLimitedFade(5, 1, blend >= 0 ? 4 : 3, abs(blend), 208, 211);
-        RSDK.RotatePalette(3, 208, 211, true);
-        RSDK.RotatePalette(4, 208, 211, true);
+        int32 blend   = RSDK.Cos1024(2 * (Zone->timer & 0x1FF)) >> 3;
+        uint8 hueBank = blend >= 0 ? 4 : 3;
+        RSDK.SetLimitedFade(5, 1, hueBank, abs(blend), 208, 211);
 
-        RSDK.SetLimitedFade(6, 2, blend >= 0 ? 4 : 3, abs(blend), 208, 211);
-        RSDK.RotatePalette(3, 208, 211, false);
-        RSDK.RotatePalette(4, 208, 211, false);
+        // only the bank being faded from needs offsetting by an entry, rotating the other one would just be undone straight after
+        RSDK.RotatePalette(hueBank, 208, 211, true);
+        RSDK.SetLimitedFade(6, 2, hueBank, abs(blend), 208, 211);
+        RSDK.RotatePalette(hueBank, 208, 211, false);
 
         RSDK.SetLimitedFade(0, 5, 6, LRZ1Setup->palTimer, 208, 211);
     }
@@ -92,8 +92,8 @@ void LRZ1Setup_StageLoad(void)
     LRZ1Setup->background2 = RSDK.GetTileLayer(RSDK.GetTileLayerID("Background 2"));
 
 #if MANIA_USE_PLUS
-    LRZ1Setup->fgLow  = RSDK.GetTileLayer(Zone->fgLayer[0]);
-    LRZ1Setup->fgHigh = RSDK.GetTileLayer(Zone->fgLayer[1]);
+    LRZ1Setup->fgLow  = Zone->fgTileLayer[0];
+    LRZ1Setup->fgHigh = Zone->fgTileLayer[1];
 #endif
 
     // Slows the vScroll of the BG when the lava lake is visible to give a nicer effect :]
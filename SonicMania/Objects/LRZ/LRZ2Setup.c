@@ -46,11 +46,10 @@ void LRZ2Setup_StaticUpdate(void)
 
     // Rock Hues
     RSDK.SetLimitedFade(5, 1, 4, abs(RSDK.Cos1024(2 * (Zone->timer & 0x1FF)) >> 3), 224, 227);
-    RSDK.RotatePalette(3, 224, 227, true);
-    RSDK.RotatePalette(4, 224, 227, true);
 
+    // bank 3 isn't read here, so only bank 4 needs offsetting by an entry for the second fade
+    RSDK.RotatePalette(4, 224, 227, true);
     RSDK.SetLimitedFade(6, 2, 4, abs(RSDK.Cos1024(2 * (Zone->timer & 0x1FF)) >> 3), 224, 227);
-    RSDK.RotatePalette(3, 224, 227, false);
     RSDK.RotatePalette(4, 224, 227, false);
 
     // Apply Lava Fading
@@ -49,7 +49,7 @@ void RisingLava_State_CheckRiseStart(void)
     foreach_active(Player, player)
     {
         if (Player_CheckCollisionTouch(player, self, &self->hitbox) && !player->sidekick) {
-            TileLayer *move               = RSDK.GetTileLayer(Zone->moveLayer);
+            TileLayer *move               = Zone->moveTileLayer;
             move->drawGroup[0]            = 5;
             move->scrollInfo[0].scrollPos = -self->offset.x;
             move->scrollPos               = -self->offset.y;
@@ -63,7 +63,7 @@ void RisingLava_State_RiseShake(void)
 {
     RSDK_THIS(RisingLava);
 
-    TileLayer *move = RSDK.GetTileLayer(Zone->moveLayer);
+    TileLayer *move = Zone->moveTileLayer;
 
     move->scrollPos += 0x8000;
     foreach_active(Player, player)
@@ -85,7 +85,7 @@ void RisingLava_State_RiseShake(void)
 
 void RisingLava_State_StoppedRising(void)
 {
-    TileLayer *move = RSDK.GetTileLayer(Zone->moveLayer);
+    TileLayer *move = Zone->moveTileLayer;
 
     foreach_active(Player, player)
     {
@@ -69,7 +69,19 @@ void BuzzSaw_StageLoad(void)
     BuzzSaw->hitbox.bottom = 24;
 
     // ඞ
-    Soundboard_LoadSfx("MMZ/SawSus.wav", true, BuzzSaw_SfxCheck_SawSus, BuzzSaw_SfxUpdate_SawSus);
+    BuzzSaw->sfxSawSus = Soundboard_LoadSfx("MMZ/SawSus.wav", true, BuzzSaw_SfxCheck_SawSus, BuzzSaw_SfxUpdate_SawSus);
+
+    // stray saws fly off from where they started, so only use emitters if every saw stays put
+    bool32 hasStraySaws = false;
+    foreach_all(BuzzSaw, straySaw)
+    {
+        if (straySaw->type == BUZZSAW_STRAY)
+            hasStraySaws = true;
+    }
+
+    if (!hasStraySaws) {
+        foreach_all(BuzzSaw, saw) { Soundboard_AddEmitter(BuzzSaw->sfxSawSus, saw, SOUNDBOARD_EMITTER_POINT, 640, NULL); }
+    }
 }
 
 bool32 BuzzSaw_SfxCheck_SawSus(void)
@@ -94,7 +106,14 @@ void BuzzSaw_SfxUpdate_SawSus(int32 sfx)
     int32 worldX = (ScreenInfo->position.x + ScreenInfo->center.x) << 16;
     int32 worldY = (ScreenInfo->position.y + ScreenInfo->center.y) << 16;
 
-    foreach_all(BuzzSaw, saw) { dist = MIN(MathHelpers_Distance(saw->position.x, saw->position.y, worldX, worldY), dist); }
+    if (Soundboard->sfxUsesEmitters[sfx]) {
+        EntityBuzzSaw *saws[8];
+        int32 count = Soundboard_GetNearbyEmitters(sfx, worldX, worldY, (Entity **)saws, 8);
+        for (int32 s = 0; s < count; ++s) dist = MIN(MathHelpers_Distance(saws[s]->position.x, saws[s]->position.y, worldX, worldY), dist);
+    }
+    else {
+        foreach_all(BuzzSaw, saw) { dist = MIN(MathHelpers_Distance(saw->position.x, saw->position.y, worldX, worldY), dist); }
+    }
 
     RSDK.SetChannelAttributes(Soundboard->sfxChannel[sfx], 1.0 - (MIN(dist >> 16, 640) / 640.0), 0.0, 1.0);
 }
@@ -15,6 +15,7 @@ struct ObjectBuzzSaw {
     Hitbox hitbox;
     Vector2 unused1;
     int32 unused2;
+    uint8 sfxSawSus;
 };
 
 // Entity Class
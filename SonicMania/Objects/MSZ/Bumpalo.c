@@ -273,7 +273,7 @@ void Bumpalo_HandlePlatformCollisions(EntityPlatform *platform)
                 if (platform->collision == PLATFORM_C_TILED
                     && RSDK.CheckObjectCollisionTouchBox(platform, &platform->hitbox, self, &Bumpalo->hitboxBadnik)) {
                     if ((self->collisionLayers & Zone->moveLayerMask) != 0) {
-                        TileLayer *move  = RSDK.GetTileLayer(Zone->moveLayer);
+                        TileLayer *move  = Zone->moveTileLayer;
                         move->position.x = -(platform->drawPos.x + platform->tileOrigin.x) >> 16;
                         move->position.y = -(platform->drawPos.y + platform->tileOrigin.y) >> 16;
                     }
@@ -144,7 +144,9 @@ void EggLoco_StageLoad(void)
 
     EggLoco->sfxSmoke   = RSDK.GetSfx("MSZ/LocoSmoke.wav");
     EggLoco->sfxWhistle = RSDK.GetSfx("MSZ/LocoWhistle.wav");
-    Soundboard_LoadSfx("MSZ/LocoChugga.wav", true, EggLoco_SfxCheck_LocoChugga, EggLoco_SfxUpdate_LocoChugga);
+    EggLoco->sfxLocoChugga = Soundboard_LoadSfx("MSZ/LocoChugga.wav", true, EggLoco_SfxCheck_LocoChugga, EggLoco_SfxUpdate_LocoChugga);
+
+    foreach_all(EggLoco, eggLoco) { Soundboard_AddEmitter(EggLoco->sfxLocoChugga, eggLoco, SOUNDBOARD_EMITTER_POINT, 840, NULL); }
 }
 
 bool32 EggLoco_SfxCheck_LocoChugga(void)
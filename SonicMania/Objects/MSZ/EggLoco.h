@@ -9,6 +9,7 @@ struct ObjectEggLoco {
     uint16 aniFrames;
     uint16 sfxSmoke;
     uint16 sfxWhistle;
+    uint8 sfxLocoChugga;
 };
 
 // Entity Class
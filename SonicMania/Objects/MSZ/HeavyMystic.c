@@ -445,7 +445,7 @@ void HeavyMystic_StateBoss_AwaitPlayer(void)
             self->visible   = true;
 
             self->state                                           = HeavyMystic_StateBoss_BeginShow;
-            RSDK.GetTileLayer(Zone->fgLayer[1])->scanlineCallback = HeavyMystic_Scanline_Curtains;
+            Zone->fgTileLayer[1]->scanlineCallback = HeavyMystic_Scanline_Curtains;
 
             foreach_active(MSZSpotlight, spotlight) { spotlight->state = MSZSpotlight_State_Appear; }
         }
@@ -724,7 +724,7 @@ void HeavyMystic_StateBoss_CloseCurtains(void)
     if (HeavyMystic->curtainLinePos >= 0xD00000) {
         HeavyMystic->curtainLinePos = 0xD00000;
 
-        RSDK.GetTileLayer(Zone->fgLayer[1])->scanlineCallback = StateMachine_None;
+        Zone->fgTileLayer[1]->scanlineCallback = StateMachine_None;
         Zone->cameraBoundsR[0] += WIDE_SCR_XSIZE * 2;
         destroyEntity(self);
     }
@@ -156,7 +156,7 @@ bool32 MSZCutsceneST_Cutscene_AwaitActFinish(EntityCutsceneSeq *host)
     if (MSZCutsceneST->finishedAct) {
         mystic->oscillate = false;
 
-        TileLayer *fgLow = RSDK.GetTileLayer(Zone->fgLayer[0]);
+        TileLayer *fgLow = Zone->fgTileLayer[0];
         for (int32 i = 0; i < fgLow->scrollInfoCount; ++i) {
             fgLow->scrollInfo[i].parallaxFactor = 0x100;
             fgLow->scrollInfo[i].scrollSpeed    = 0;
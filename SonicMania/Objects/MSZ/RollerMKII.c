@@ -236,7 +236,7 @@ bool32 RollerMKII_HandlePlatformCollisions(EntityPlatform *platform)
                 if (platform->collision == PLATFORM_C_TILED
                     && RSDK.CheckObjectCollisionTouchBox(platform, &platform->hitbox, self, &RollerMKII->hitboxObject)) {
                     if (self->collisionLayers & Zone->moveLayerMask) {
-                        TileLayer *move  = RSDK.GetTileLayer(Zone->moveLayer);
+                        TileLayer *move  = Zone->moveTileLayer;
                         move->position.x = -(platform->drawPos.x + platform->tileOrigin.x) >> 16;
                         move->position.y = -(platform->drawPos.y + platform->tileOrigin.y) >> 16;
                     }
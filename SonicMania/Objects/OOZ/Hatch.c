@@ -23,7 +23,7 @@ void Hatch_Update(void)
         foreach_all(Player, player)
         {
             if (Player_CheckCollisionTouch(player, self, &self->hitbox)) {
-                TileLayer *moveLayer = RSDK.GetTileLayer(Zone->moveLayer);
+                TileLayer *moveLayer = Zone->moveTileLayer;
                 if (!player->sidekick) {
                     moveLayer->scrollPos               = -self->vScrollPos;
                     moveLayer->scrollInfo[0].scrollPos = -self->hScrollPos;
@@ -312,7 +312,7 @@ void Hatch_State_Descend(void)
                 player->visible                                 = true;
             }
 
-            RSDK.GetTileLayer(Zone->moveLayer)->scrollPos = 0;
+            Zone->moveTileLayer->scrollPos = 0;
 
             self->position.x = self->startPos.x;
             self->position.y = self->startPos.y;
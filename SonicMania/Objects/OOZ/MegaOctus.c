@@ -452,7 +452,7 @@ void MegaOctus_State_SetupArena(void)
     Zone->cameraBoundsL[0]      = ScreenInfo->position.x;
 
     if (RSDK_GET_ENTITY(SLOT_PLAYER1, Player)->position.x > self->origin.x) {
-        RSDK.GetTileLayer(Zone->fgLayer[0])->drawGroup[0] = 2;
+        Zone->fgTileLayer[0]->drawGroup[0] = 2;
         Zone->playerBoundActiveL[0]                       = true;
         Zone->cameraBoundsL[0]                            = (self->position.x >> 16) - 192;
 
@@ -61,7 +61,7 @@ void OOZ2Outro_Create(void *data)
             if (!self->size.y)
                 self->size.y = SCREEN_YSIZE << 16;
 
-            self->moveLayer   = RSDK.GetTileLayer(Zone->moveLayer);
+            self->moveLayer   = Zone->moveTileLayer;
             self->updateRange = self->size;
             foreach_all(EggPrison, prison)
             {
@@ -72,17 +72,9 @@ void Smog_Draw(void)
     int32 y          = (Zone->timer + (ScreenInfo->position.y << 1)) << 14;
     uint8 scanlineID = ((ScreenInfo->position.y >> 1) + 2 * Zone->timer);
 
-    ScanlineInfo *scanline = Smog->scanlines;
-    for (int32 i = 0; i < ScreenInfo->size.y; ++i) {
-        scanline->position.x = TO_FIXED(ScreenInfo->position.x) + Smog->scanlineList[scanlineID].position.x;
-        scanline->position.y = y;
-        scanline->deform.x   = Smog->scanlineList[scanlineID].deform.x;
-        scanline->deform.y   = 0;
-    
-        y += Smog->scanlineList[(scanlineID + 1) & 0xFF].deform.y;
-        scanline++;
-        scanlineID++;
-    }
+    // the table's y positions are running totals, so offset them to start from 'y' at the current phase
+    DrawHelpers_DrawPeriodicScanlines(&Smog->scanlineTable, Smog->scanlines, scanlineID, ScreenInfo->size.y, TO_FIXED(ScreenInfo->position.x),
+                                      y - Smog->scanlineTable.lines[scanlineID].position.y);
 
     if (self->alpha >= 0x80)
         RSDK.DrawDeformedSprite(Smog->aniFrames, INK_BLEND, 0xE0);
@@ -158,17 +150,27 @@ void Smog_StageLoad(void)
     Smog->aniFrames = RSDK.LoadSpriteSheet("OOZ/Smog.gif", SCOPE_STAGE);
     Smog->scanlines = RSDK.GetScanlines();
 
-    ScanlineInfo *scanline = (ScanlineInfo *)Smog->scanlineList;
-    int32 angle            = 0;
+    // deform.y only ever feeds the running y position, so each line stores the total of every deform.y after line 0 up to it instead
+    ScanlineInfo period[0x100];
+    int32 angle = 0;
+    int32 total = 0;
     for (int32 i = 0; i < 0x100; ++i) {
-        scanline[i].deform.x   = (RSDK.Sin256(angle >> 1) << 6) + 0x10000;
-        scanline[i].deform.y   = (RSDK.Sin256(angle >> 1) << 5) + 0x10000;
-        scanline[i].position.x = (RSDK.Sin256(angle) << 10) - scanline[i].deform.x * ScreenInfo->center.x;
-        scanline[i].position.y = 0;
+        int32 deformY = (RSDK.Sin256(angle >> 1) << 5) + 0x10000;
+        if (i)
+            total += deformY;
+
+        period[i].deform.x   = (RSDK.Sin256(angle >> 1) << 6) + 0x10000;
+        period[i].deform.y   = 0;
+        period[i].position.x = (RSDK.Sin256(angle) << 10) - period[i].deform.x * ScreenInfo->center.x;
+        period[i].position.y = total;
 
         angle += 2;
     }
 
+    // line 0's deform.y gets added when the table wraps around
+    total += (RSDK.Sin256(0) << 5) + 0x10000;
+    DrawHelpers_SetupPeriodicScanlines(&Smog->scanlineTable, period, 0x100, 0, total);
+
     RSDK.CopyPalette(0, 0, 1, 0, 128);
     RSDK.CopyPalette(0, 0, 2, 0, 128);
     RSDK.SetLimitedFade(2, 1, 3, 64, 0, 127);
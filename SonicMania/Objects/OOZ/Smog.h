@@ -8,7 +8,7 @@ struct ObjectSmog {
     RSDK_OBJECT
     bool32 forceEnabled;
     ScanlineInfo *scanlines;
-    ScanlineInfo scanlineList[0x100];
+    PeriodicScanlines scanlineTable;
     uint16 aniFrames;
     int32 starPostID;
 };
@@ -24,6 +24,8 @@ void Ice_StaticUpdate(void)
         if (Ice->playerTimers[i] > 0)
             Ice->playerTimers[i]--;
     }
+
+    Ice->solidGridsBuilt = false;
 }
 
 void Ice_Draw(void)
@@ -37,6 +39,9 @@ void Ice_Create(void *data)
 {
     RSDK_THIS(Ice);
 
+    // a new block (or a reused slot) isn't in this frame's grids yet
+    Ice->solidGridsBuilt = false;
+
     if (!SceneInfo->inEditor) {
         self->drawFX    = FX_FLIP;
         self->drawGroup = Zone->playerDrawGroup[0] + 1;
@@ -330,6 +335,8 @@ void Ice_StageLoad(void)
     Ice->playerTimers[2] = 0;
     Ice->playerTimers[3] = 0;
 
+    Ice->solidGridsBuilt = false;
+
     Ice->sfxFreeze        = RSDK.GetSfx("PSZ/Freeze.wav");
     Ice->sfxLedgeBreak    = RSDK.GetSfx("Stage/LedgeBreak.wav");
     Ice->sfxWindowShatter = RSDK.GetSfx("Stage/WindowShatter.wav");
@@ -563,17 +570,17 @@ void Ice_ShatterGenerator(int32 count, int32 sizeX, int32 sizeY, int32 velX, int
         count >>= 1;
 
     for (int32 i = 0; i < MAX(0, count); ++i) {
-        int32 x        = self->position.x + (RSDK.Rand(-sizeX, sizeX + 1) << 16);
-        int32 y        = self->position.y + (RSDK.Rand(-sizeY, sizeY + 1) << 16);
+        int32 x        = self->position.x + (COSMETIC_RAND(-sizeX, sizeX + 1) << 16);
+        int32 y        = self->position.y + (COSMETIC_RAND(-sizeY, sizeY + 1) << 16);
         EntityIce *ice = CREATE_ENTITY(Ice, INT_TO_VOID(ICE_CHILD_SHARD), x, y);
 
-        ice->velocity.x          = velX + (RSDK.Rand(-6, 8) << 15);
-        ice->velocity.y          = velY + (RSDK.Rand(-10, 2) << 15);
-        ice->direction           = RSDK.Rand(0, 4);
-        ice->blockAnimator.speed = RSDK.Rand(1, 4);
+        ice->velocity.x          = velX + (COSMETIC_RAND(-6, 8) << 15);
+        ice->velocity.y          = velY + (COSMETIC_RAND(-10, 2) << 15);
+        ice->direction           = COSMETIC_RAND(0, 4);
+        ice->blockAnimator.speed = COSMETIC_RAND(1, 4);
 
         if (canBreak) {
-            if (RSDK.Rand(0, 2)) {
+            if (COSMETIC_RAND(0, 2)) {
                 RSDK.SetSpriteAnimation(Ice->aniFrames, ICEANI_PIECE, &ice->blockAnimator, true, 0);
                 ice->velocity.x = (ice->velocity.x >> 1) + (ice->velocity.x >> 2);
                 ice->velocity.y = (ice->velocity.y >> 1) + (ice->velocity.y >> 2);
@@ -716,6 +723,83 @@ void Ice_TimeOver_CheckFrozen(void)
         Ice_BreakPlayerBlock(player);
 }
 
+void Ice_ClearSolidGrid(IceSolidGrid *grid)
+{
+    for (int32 c = 0; c < ICE_GRID_COLUMN_COUNT; ++c) {
+        grid->columnHead[c] = ICE_GRID_NONE;
+        grid->columnTail[c] = ICE_GRID_NONE;
+    }
+
+    grid->dynamicCount = 0;
+    grid->reach        = 0;
+}
+
+void Ice_AddToSolidGrid(IceSolidGrid *grid, void *entity, Hitbox *hitbox, bool32 dynamic)
+{
+    uint16 slot = RSDK.GetEntitySlot(entity);
+
+    if (dynamic) {
+        // solids that travel with the player can't be trusted to stay in their column
+        grid->dynamicSlots[grid->dynamicCount++] = slot;
+    }
+    else {
+        int32 column = (((Entity *)entity)->position.x >> 16) >> ICE_GRID_COLUMN_SHIFT;
+        column       = CLAMP(column, 0, ICE_GRID_COLUMN_COUNT - 1);
+
+        grid->next[slot] = ICE_GRID_NONE;
+        if (grid->columnTail[column] == ICE_GRID_NONE)
+            grid->columnHead[column] = slot;
+        else
+            grid->next[grid->columnTail[column]] = slot;
+        grid->columnTail[column] = slot;
+
+        grid->reach = MAX(grid->reach, MAX(-hitbox->left, hitbox->right));
+    }
+}
+
+void Ice_BuildSolidGrids(void)
+{
+    Ice_ClearSolidGrid(&Ice->iceGrid);
+    foreach_all(Ice, ice) { Ice_AddToSolidGrid(&Ice->iceGrid, ice, &ice->hitboxBlock, ice->stateDraw == Ice_Draw_PlayerBlock); }
+
+    Ice_ClearSolidGrid(&Ice->spikesGrid);
+    foreach_all(Spikes, spikes) { Ice_AddToSolidGrid(&Ice->spikesGrid, spikes, &spikes->hitbox, false); }
+
+    Ice_ClearSolidGrid(&Ice->itemBoxGrid);
+    foreach_all(ItemBox, itemBox) { Ice_AddToSolidGrid(&Ice->itemBoxGrid, itemBox, &ItemBox->hitboxItemBox, false); }
+
+    Ice->solidGridsBuilt = true;
+}
+
+int32 Ice_GetSolidGridCandidates(IceSolidGrid *grid)
+{
+    RSDK_THIS(Ice);
+
+    int32 reach  = grid->reach + ICE_GRID_SLACK;
+    int32 left   = ((self->position.x >> 16) + self->hitboxBlock.left - reach) >> ICE_GRID_COLUMN_SHIFT;
+    int32 right  = ((self->position.x >> 16) + self->hitboxBlock.right + reach) >> ICE_GRID_COLUMN_SHIFT;
+    left         = CLAMP(left, 0, ICE_GRID_COLUMN_COUNT - 1);
+    right        = CLAMP(right, 0, ICE_GRID_COLUMN_COUNT - 1);
+    int32 count  = 0;
+    uint16 *list = Ice->gridCandidates;
+
+    for (int32 c = left; c <= right; ++c) {
+        for (uint16 slot = grid->columnHead[c]; slot != ICE_GRID_NONE; slot = grid->next[slot]) list[count++] = slot;
+    }
+
+    for (int32 i = 0; i < grid->dynamicCount; ++i) list[count++] = grid->dynamicSlots[i];
+
+    // each column is already sorted, so this is just a cheap merge back into foreach_all order
+    for (int32 i = 1; i < count; ++i) {
+        uint16 slot = list[i];
+        int32 j     = i - 1;
+        for (; j >= 0 && list[j] > slot; --j) list[j + 1] = list[j];
+        list[j + 1] = slot;
+    }
+
+    return count;
+}
+
 void Ice_UpdateBlockGravity(void)
 {
     RSDK_THIS(Ice);
@@ -1047,9 +1131,15 @@ void Ice_State_IceBlockFall(void)
     }
     else {
         int32 velY = self->velocity.y;
-        foreach_all(Ice, ice)
-        {
-            if (ice != self) {
+
+        if (!Ice->solidGridsBuilt)
+            Ice_BuildSolidGrids();
+
+        int32 count = Ice_GetSolidGridCandidates(&Ice->iceGrid);
+        for (int32 i = 0; i < count; ++i) {
+            EntityIce *ice = RSDK_GET_ENTITY(Ice->gridCandidates[i], Ice);
+
+            if (ice != self && ice->classID == Ice->classID) {
                 if ((ice->stateDraw == Ice_Draw_IceBlock || ice->stateDraw == Ice_Draw_PlayerBlock)
                     && RSDK.CheckObjectCollisionPlatform(ice, &ice->hitboxBlock, self, &self->hitboxBlock, true)) {
                     self->velocity.y = 0;
@@ -1062,18 +1152,22 @@ void Ice_State_IceBlockFall(void)
             }
         }
 
-        foreach_all(Spikes, spikes)
-        {
-            if (RSDK.CheckObjectCollisionPlatform(spikes, &spikes->hitbox, self, &self->hitboxBlock, true)) {
+        count = Ice_GetSolidGridCandidates(&Ice->spikesGrid);
+        for (int32 i = 0; i < count; ++i) {
+            EntitySpikes *spikes = RSDK_GET_ENTITY(Ice->gridCandidates[i], Spikes);
+
+            if (spikes->classID == Spikes->classID && RSDK.CheckObjectCollisionPlatform(spikes, &spikes->hitbox, self, &self->hitboxBlock, true)) {
                 self->velocity.y = 0;
                 self->active     = ACTIVE_BOUNDS;
                 self->state      = Ice_State_IceBlock;
             }
         }
 
-        foreach_all(ItemBox, itemBox)
-        {
-            if ((itemBox->state == ItemBox_State_Idle || itemBox->state == ItemBox_State_Falling)
+        count = Ice_GetSolidGridCandidates(&Ice->itemBoxGrid);
+        for (int32 i = 0; i < count; ++i) {
+            EntityItemBox *itemBox = RSDK_GET_ENTITY(Ice->gridCandidates[i], ItemBox);
+
+            if (itemBox->classID == ItemBox->classID && (itemBox->state == ItemBox_State_Idle || itemBox->state == ItemBox_State_Falling)
                 && RSDK.CheckObjectCollisionPlatform(itemBox, &ItemBox->hitboxItemBox, self, &self->hitboxBlock, true)) {
                 self->velocity.y = 0;
 
@@ -1085,6 +1179,10 @@ void Ice_State_IceBlockFall(void)
         }
 
         if (!self->velocity.y && velY >= 0x60000) {
+            // the original foreach_all left its iterator on the last Ice in the scene, and that's the one that shatters here
+            EntityIce *ice = NULL;
+            foreach_all(Ice, lastIce) { ice = lastIce; }
+
             if (ice) {
                 if (ice->stateDraw == Ice_Draw_PlayerBlock) {
                     Ice_BreakPlayerBlock(ice->playerPtr);
@@ -1129,14 +1227,14 @@ void Ice_State_PlayerBlock(void)
 
             if (--self->glintTimer <= 0) {
                 RSDK.SetSpriteAnimation(Ice->aniFrames, ICEANI_PLAYERGLINT, &self->altContentsAnimator, true, 0);
-                self->glintTimer = 30 * RSDK.Rand(1, 9);
+                self->glintTimer = 30 * COSMETIC_RAND(1, 9);
             }
 
             self->blockAnimator.frameID = playerPtr->timer;
 
             if (playerPtr->spindashCharge) {
-                self->contentsOffset.x = RSDK.Rand(-1, 2) << 16;
-                self->contentsOffset.y = RSDK.Rand(-1, 2) << 16;
+                self->contentsOffset.x = COSMETIC_RAND(-1, 2) << 16;
+                self->contentsOffset.y = COSMETIC_RAND(-1, 2) << 16;
             }
             else {
                 self->contentsOffset.x = 0;
@@ -1173,14 +1271,14 @@ void Ice_State_PlayerBlock(void)
 
             if (--self->glintTimer <= 0) {
                 RSDK.SetSpriteAnimation(Ice->aniFrames, ICEANI_PLAYERGLINT, &self->altContentsAnimator, true, 0);
-                self->glintTimer = 30 * RSDK.Rand(1, 9);
+                self->glintTimer = 30 * COSMETIC_RAND(1, 9);
             }
 
             self->blockAnimator.frameID = playerPtr->timer;
 
             if (playerPtr->spindashCharge) {
-                self->contentsOffset.x = RSDK.Rand(-1, 2) << 16;
-                self->contentsOffset.y = RSDK.Rand(-1, 2) << 16;
+                self->contentsOffset.x = COSMETIC_RAND(-1, 2) << 16;
+                self->contentsOffset.y = COSMETIC_RAND(-1, 2) << 16;
             }
             else {
                 self->contentsOffset.x = 0;
@@ -1212,14 +1310,14 @@ void Ice_State_PlayerBlock(void)
 #else
         if (--self->glintTimer <= 0) {
             RSDK.SetSpriteAnimation(Ice->aniFrames, ICEANI_PLAYERGLINT, &self->altContentsAnimator, true, 0);
-            self->glintTimer = 30 * RSDK.Rand(1, 9);
+            self->glintTimer = 30 * COSMETIC_RAND(1, 9);
         }
 
         self->blockAnimator.frameID = playerPtr->timer;
 
         if (playerPtr->spindashCharge) {
-            self->contentsOffset.x = RSDK.Rand(-1, 2) << 16;
-            self->contentsOffset.y = RSDK.Rand(-1, 2) << 16;
+            self->contentsOffset.x = COSMETIC_RAND(-1, 2) << 16;
+            self->contentsOffset.y = COSMETIC_RAND(-1, 2) << 16;
         }
         else {
             self->contentsOffset.x = 0;
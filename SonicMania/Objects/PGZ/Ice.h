@@ -92,6 +92,22 @@ typedef enum {
     ICE_CHILD_SHARD,
 } IceChildTypes;
 
+#define ICE_GRID_COLUMN_SHIFT (7) // 128px wide columns
+#define ICE_GRID_COLUMN_COUNT (0x100)
+#define ICE_GRID_SLACK        (64) // extra reach (in pixels) to cover solids that moved since the grid was built
+#define ICE_GRID_NONE         (0xFFFF)
+
+// Per-frame column buckets for the solids a falling ice block can land on
+// each column lists its entity slots in ascending order, so queries can keep the original foreach order
+typedef struct {
+    uint16 columnHead[ICE_GRID_COLUMN_COUNT];
+    uint16 columnTail[ICE_GRID_COLUMN_COUNT];
+    uint16 next[ENTITY_COUNT];
+    uint16 dynamicSlots[ENTITY_COUNT];
+    uint16 dynamicCount;
+    int32 reach;
+} IceSolidGrid;
+
 // Object Class
 struct ObjectIce {
     RSDK_OBJECT
@@ -103,6 +119,11 @@ struct ObjectIce {
     uint16 sfxLedgeBreak;
     uint16 sfxWindowShatter;
     uint16 sfxStruggle;
+    bool32 solidGridsBuilt;
+    IceSolidGrid iceGrid;
+    IceSolidGrid spikesGrid;
+    IceSolidGrid itemBoxGrid;
+    uint16 gridCandidates[ENTITY_COUNT];
 };
 
 // Entity Class
@@ -160,6 +181,11 @@ void Ice_BreakPlayerBlock(EntityPlayer *player);
 EntityItemBox *Ice_Shatter(EntityIce *ice, int32 velX, int32 velY);
 void Ice_TimeOver_CheckFrozen(void);
 
+void Ice_ClearSolidGrid(IceSolidGrid *grid);
+void Ice_AddToSolidGrid(IceSolidGrid *grid, void *entity, Hitbox *hitbox, bool32 dynamic);
+void Ice_BuildSolidGrids(void);
+int32 Ice_GetSolidGridCandidates(IceSolidGrid *grid);
+
 void Ice_UpdateBlockGravity(void);
 void Ice_State_IceBlock(void);
 void Ice_State_StartBlockFall(void);
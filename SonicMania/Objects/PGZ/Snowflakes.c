@@ -13,30 +13,30 @@ void Snowflakes_Update(void)
 {
     RSDK_THIS(Snowflakes);
 
-    if (Snowflakes->count < 0x40 && !(Zone->timer % 16)) {
-        for (int32 i = 0; i < 0x40; ++i) {
-            if (!self->positions[i].x && !self->positions[i].y && (i & 0x8000) == 0) {
-                int32 screenY = ScreenInfo->position.y;
-                int32 scrX    = ScreenInfo->position.x % ScreenInfo->size.x;
-                int32 posX    = (scrX + ZONE_RAND(0, ScreenInfo->size.x)) % ScreenInfo->size.x;
-
-                self->positions[i].y = (screenY - 5) << 16;
-                self->positions[i].x = posX << 16;
-                self->frameIDs[i]    = 0;
-                self->priority[i]    = ZONE_RAND(0, 10) > 7;
-
-                if (self->priority[i]) {
-                    self->animIDs[i] = 2 * (ZONE_RAND(0, 10) > 7) + 2;
-                }
-                else {
-                    int32 type       = ZONE_RAND(0, 10);
-                    self->animIDs[i] = type > 8 ? 3 : (type > 4 ? 1 : 0);
-                }
+    AmbientParticles *flakes = &self->flakes;
 
-                self->angles[i] = ZONE_RAND(0, 256);
-                ++Snowflakes->count;
-                break;
+    if (Snowflakes->count < 0x40 && !(Zone->timer % 16)) {
+        int32 i = ParticleHelpers_SpawnAmbientParticle(flakes);
+        if (i >= 0) {
+            int32 screenY = ScreenInfo->position.y;
+            int32 scrX    = ScreenInfo->position.x % ScreenInfo->size.x;
+            int32 posX    = (scrX + ZONE_RAND(0, ScreenInfo->size.x)) % ScreenInfo->size.x;
+
+            flakes->positions[i].y = (screenY - 5) << 16;
+            flakes->positions[i].x = posX << 16;
+            flakes->frameIDs[i]    = 0;
+            flakes->layers[i]      = ZONE_RAND(0, 10) > 7;
+
+            if (flakes->layers[i]) {
+                flakes->animIDs[i] = 2 * (ZONE_RAND(0, 10) > 7) + 2;
+            }
+            else {
+                int32 type         = ZONE_RAND(0, 10);
+                flakes->animIDs[i] = type > 8 ? 3 : (type > 4 ? 1 : 0);
             }
+
+            flakes->angles[i] = ZONE_RAND(0, 256);
+            ++Snowflakes->count;
         }
     }
 
@@ -44,36 +44,31 @@ void Snowflakes_Update(void)
     range.x = 0x800000;
     range.y = 0x800000;
 
-    for (int32 i = 0; i < 0x40; ++i) {
-        if (self->positions[i].x || self->positions[i].y) {
-            Vector2 pos = Snowflakes_HandleWrap(i);
-            int32 angle = RSDK.Sin256(self->angles[i]) << 6;
-
-            self->positions[i].x += angle;
-            self->positions[i].y += 0x8000;
-            pos.x += angle;
-            pos.y += 0x8000;
+    // check where each flake is about to end up before moving them all at once, wrapping is done from the flake's current position
+    for (int32 i = ParticleHelpers_NextAmbientParticle(flakes, -1); i >= 0; i = ParticleHelpers_NextAmbientParticle(flakes, i)) {
+        Vector2 pos = Snowflakes_HandleWrap(i);
+        pos.x += RSDK.Sin256(flakes->angles[i]) << 6;
+        pos.y += 0x8000;
 
-            self->frameIDs[i]++;
+        if (!RSDK.CheckPosOnScreen(&pos, &range)) {
+            ParticleHelpers_RemoveAmbientParticle(flakes, i);
+            --Snowflakes->count;
+        }
+    }
 
-            if (self->animIDs[i] <= 2)
-                self->frameIDs[i] %= 12;
+    ParticleHelpers_StepAmbientParticles(flakes, 6, 0x8000);
 
-            if (self->animIDs[i] <= 3)
-                self->frameIDs[i] %= 24;
+    for (int32 i = ParticleHelpers_NextAmbientParticle(flakes, -1); i >= 0; i = ParticleHelpers_NextAmbientParticle(flakes, i)) {
+        flakes->frameIDs[i]++;
 
-            if (self->animIDs[i] <= 4)
-                self->frameIDs[i] %= 48;
+        if (flakes->animIDs[i] <= 2)
+            flakes->frameIDs[i] %= 12;
 
-            ++self->angles[i];
-            self->angles[i] &= 0xFF;
+        if (flakes->animIDs[i] <= 3)
+            flakes->frameIDs[i] %= 24;
 
-            if (!RSDK.CheckPosOnScreen(&pos, &range)) {
-                self->positions[i].x = 0;
-                self->positions[i].y = 0;
-                --Snowflakes->count;
-            }
-        }
+        if (flakes->animIDs[i] <= 4)
+            flakes->frameIDs[i] %= 48;
     }
 
     RSDK.ProcessAnimation(&self->animator);
@@ -89,41 +84,47 @@ void Snowflakes_StaticUpdate(void)
 void Snowflakes_Draw(void)
 {
     RSDK_THIS(Snowflakes);
-    int32 drawHigh  = Zone->objectDrawGroup[1];
-    int32 drawGroup = SceneInfo->currentDrawGroup;
+    AmbientParticles *flakes = &self->flakes;
+    int32 drawHigh           = Zone->objectDrawGroup[1];
+    int32 drawGroup          = SceneInfo->currentDrawGroup;
 
-    for (int32 i = 0; i < 0x40; ++i) {
-        if (self->positions[i].x || self->positions[i].y) {
-            int32 priority = self->priority[i];
+    Vector2 range;
+    range.x = 0x200000;
+    range.y = 0x200000;
 
-            if ((priority || drawGroup != drawHigh) && (priority != 1 || drawGroup == drawHigh)) {
-                Vector2 drawPos = Snowflakes_HandleWrap(i);
-                self->direction = FLIP_NONE;
-                int32 angle     = RSDK.Sin256(self->angles[i]) << 6;
+    for (int32 i = ParticleHelpers_NextAmbientParticle(flakes, -1); i >= 0; i = ParticleHelpers_NextAmbientParticle(flakes, i)) {
+        int32 priority = flakes->layers[i];
 
-                if (self->animIDs[i] <= 2) {
-                    RSDK.SetSpriteAnimation(Snowflakes->aniFrames, self->animIDs[i], &self->animator, true, self->frameIDs[i] >> 2);
-                    RSDK.DrawSprite(&self->animator, &drawPos, false);
-                }
-                else {
-                    int32 frame = 0;
+        if ((priority || drawGroup != drawHigh) && (priority != 1 || drawGroup == drawHigh)) {
+            Vector2 drawPos = Snowflakes_HandleWrap(i);
+            if (!Zone_CheckPosOnCurrentScreen(&drawPos, &range))
+                continue;
 
-                    if (self->animIDs[i] == 4) {
-                        frame = self->frameIDs[i] / 3;
+            self->direction = FLIP_NONE;
+            int32 angle     = RSDK.Sin256(flakes->angles[i]) << 6;
 
-                        if (angle > 0)
-                            self->direction = FLIP_X;
-                    }
-                    else if (self->animIDs[i] == 3) {
-                        frame = self->frameIDs[i] >> 2;
+            if (flakes->animIDs[i] <= 2) {
+                RSDK.SetSpriteAnimation(Snowflakes->aniFrames, flakes->animIDs[i], &self->animator, true, flakes->frameIDs[i] >> 2);
+                RSDK.DrawSprite(&self->animator, &drawPos, false);
+            }
+            else {
+                int32 frame = 0;
 
-                        if (angle > 0)
-                            self->direction = FLIP_X;
-                    }
+                if (flakes->animIDs[i] == 4) {
+                    frame = flakes->frameIDs[i] / 3;
 
-                    RSDK.SetSpriteAnimation(Snowflakes->aniFrames, self->animIDs[i], &self->animator, true, frame);
-                    RSDK.DrawSprite(&self->animator, &drawPos, false);
+                    if (angle > 0)
+                        self->direction = FLIP_X;
                 }
+                else if (flakes->animIDs[i] == 3) {
+                    frame = flakes->frameIDs[i] >> 2;
+
+                    if (angle > 0)
+                        self->direction = FLIP_X;
+                }
+
+                RSDK.SetSpriteAnimation(Snowflakes->aniFrames, flakes->animIDs[i], &self->animator, true, frame);
+                RSDK.DrawSprite(&self->animator, &drawPos, false);
             }
         }
     }
@@ -139,6 +140,8 @@ void Snowflakes_Create(void *data)
     self->drawFX        = FX_FLIP;
     self->updateRange.x = 0x800000;
     self->updateRange.y = 0x800000;
+
+    ParticleHelpers_InitAmbientParticles(&self->flakes, 0x40);
 }
 
 void Snowflakes_StageLoad(void)
@@ -152,11 +155,11 @@ Vector2 Snowflakes_HandleWrap(int32 id)
 {
     RSDK_THIS(Snowflakes);
 
-    int32 x = self->positions[id].x;
-    int32 y = self->positions[id].y;
+    int32 x = self->flakes.positions[id].x;
+    int32 y = self->flakes.positions[id].y;
 
     int32 mult = 128;
-    if (!self->priority[id])
+    if (!self->flakes.layers[id])
         mult = 64;
 
     int32 newX = x - (ScreenInfo->position.x << 8) * mult;
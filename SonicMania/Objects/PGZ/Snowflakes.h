@@ -18,11 +18,7 @@ struct EntitySnowflakes {
     int32 unused2;
     int32 unused3;
     Animator animator;
-    uint8 animIDs[0x40];
-    uint16 frameIDs[0x40];
-    Vector2 positions[0x40];
-    uint8 priority[0x40];
-    uint16 angles[0x40];
+    AmbientParticles flakes; // layers are 0 for low priority flakes & 1 for high priority ones
 };
 
 // Object Struct
@@ -85,6 +85,10 @@ void PBL_Setup_StageLoad(void)
     PBL_Setup->score       = 0;
     PBL_Setup->score1UP    = 10000;
 
+    PBL_Setup->tableLowCache.valid  = false;
+    PBL_Setup->tableHighCache.valid = false;
+    PBL_Setup->pinballBGCache.valid = false;
+
     RSDK.GetTileLayer(PBL_Setup->tableLow)->scanlineCallback  = PBL_Setup_Scanline_TableLow;
     RSDK.GetTileLayer(PBL_Setup->tableHigh)->scanlineCallback = PBL_Setup_Scanline_TableHigh;
     RSDK.GetTileLayer(1)->scanlineCallback                    = PBL_Setup_Scanline_PinballBG;
@@ -110,35 +114,60 @@ void PBL_Setup_Scanline_TableLow(ScanlineInfo *scanlines)
     EntityPBL_Camera *camera = RSDK_GET_ENTITY(SLOT_PBL_CAMERA, PBL_Camera);
     RSDK.SetClipBounds(0, 0, camera->centerY, ScreenInfo->size.x, ScreenInfo->size.y);
 
-    int32 sin    = RSDK.Sin1024(camera->angle) >> 2;
-    int32 cos    = RSDK.Cos1024(camera->angle) >> 2;
-    int32 negSin = RSDK.Sin1024(-camera->rotationY) >> 2;
-    int32 negCos = RSDK.Cos1024(-camera->rotationY) >> 2;
-    int32 cosVal = -ScreenInfo->center.y * negCos;
+    PBL_Setup_BuildTableScanlines(&PBL_Setup->tableLowCache, camera, camera->worldY, 27);
+    PBL_Setup_DrawCachedScanlines(&PBL_Setup->tableLowCache, scanlines, camera->position.x, camera->position.y, 120 - ScreenInfo->center.y);
+}
+void PBL_Setup_Scanline_TableHigh(ScanlineInfo *scanlines)
+{
+    EntityPBL_Camera *camera = RSDK_GET_ENTITY(SLOT_PBL_CAMERA, PBL_Camera);
+    RSDK.SetClipBounds(0, 0, camera->centerY, ScreenInfo->size.x, ScreenInfo->size.y);
 
-    for (int32 i = -ScreenInfo->center.y; i < ScreenInfo->center.y; ++i) {
-        int32 div = negSin + (cosVal >> 8);
-        if (!div)
-            div = 1;
+    PBL_Setup_BuildTableScanlines(&PBL_Setup->tableHighCache, camera, camera->worldY - 0x100000, 24);
+    PBL_Setup_DrawCachedScanlines(&PBL_Setup->tableHighCache, scanlines, camera->position.x, camera->position.y, 120 - ScreenInfo->center.y);
+}
+void PBL_Setup_Scanline_PinballBG(ScanlineInfo *scanlines)
+{
+    RSDK.SetClipBounds(0, 0, 0, ScreenInfo->size.x, 112);
 
-        int32 mult          = camera->worldY / div;
-        scanlines->deform.x = -(cos * mult) >> 8;
-        scanlines->deform.y = sin * mult >> 8;
+    PBL_ScanlineCache *cache = &PBL_Setup->pinballBGCache;
+    if (!cache->valid || cache->center.x != ScreenInfo->center.x) {
+        int32 x       = 116 << 16;
+        int32 centerX = ScreenInfo->center.x;
+        int32 sin     = RSDK.Sin256(32);
+        int32 cos     = RSDK.Cos256(32);
 
-        int32 pos = (negCos * mult >> 8) - (negSin * (i * mult >> 8) >> 8);
-        RSDK.SetActivePalette(CLAMP((abs(pos) >> 12) - 27, 0, 7), i + 120, i + 121);
+        ScanlineInfo *line = cache->lines;
+        int32 clr          = 0;
+        for (int32 i = 160; i > 40; --i) {
+            x += 0xE000;
+            int32 id = x / (8 * i);
 
-        scanlines->position.x = (sin * pos - ScreenInfo->center.x * scanlines->deform.x) + camera->position.x;
-        scanlines->position.y = (cos * pos - ScreenInfo->center.x * scanlines->deform.y) + camera->position.y;
+            line->deform.x   = -(cos * id) >> 7;
+            line->deform.y   = sin * id >> 7;
+            line->position.x = sin * id - centerX * line->deform.x;
+            line->position.y = cos * id - centerX * (sin * id >> 7);
 
-        cosVal += negCos;
-        scanlines++;
+            cache->paletteIDs[clr] = CLAMP((abs(id) >> 11) - 16, 0, 7);
+
+            line++;
+            ++clr;
+        }
+
+        cache->center.x  = ScreenInfo->center.x;
+        cache->lineCount = clr;
+        cache->valid     = true;
     }
+
+    int32 timer = PBL_Setup->scanlineTimer >> 1;
+    PBL_Setup_DrawCachedScanlines(cache, scanlines, timer, timer, 0);
 }
-void PBL_Setup_Scanline_TableHigh(ScanlineInfo *scanlines)
+
+void PBL_Setup_BuildTableScanlines(PBL_ScanlineCache *cache, EntityPBL_Camera *camera, int32 height, int32 paletteOffset)
 {
-    EntityPBL_Camera *camera = RSDK_GET_ENTITY(SLOT_PBL_CAMERA, PBL_Camera);
-    RSDK.SetClipBounds(0, 0, camera->centerY, ScreenInfo->size.x, ScreenInfo->size.y);
+    // camera translation only offsets the final positions, so there's nothing to rebuild unless the perspective itself changed
+    if (cache->valid && cache->angle == camera->angle && cache->rotationY == camera->rotationY && cache->height == height
+        && cache->center.x == ScreenInfo->center.x && cache->center.y == ScreenInfo->center.y)
+        return;
 
     int32 sin    = RSDK.Sin1024(camera->angle) >> 2;
     int32 cos    = RSDK.Cos1024(camera->angle) >> 2;
@@ -146,49 +175,55 @@ void PBL_Setup_Scanline_TableHigh(ScanlineInfo *scanlines)
     int32 negCos = RSDK.Cos1024(-camera->rotationY) >> 2;
     int32 cosVal = -ScreenInfo->center.y * negCos;
 
-    for (int32 i = -ScreenInfo->center.y; i < ScreenInfo->center.y; ++i) {
+    ScanlineInfo *line = cache->lines;
+    int32 lineCount    = 0;
+    for (int32 i = -ScreenInfo->center.y; i < ScreenInfo->center.y && lineCount < SCREEN_YSIZE; ++i) {
         int32 div = negSin + (cosVal >> 8);
         if (!div)
             div = 1;
 
-        int32 mult          = (camera->worldY - 0x100000) / div;
-        scanlines->deform.x = -(cos * mult) >> 8;
-        scanlines->deform.y = sin * mult >> 8;
+        int32 mult     = height / div;
+        line->deform.x = -(cos * mult) >> 8;
+        line->deform.y = sin * mult >> 8;
 
-        int32 pos = (negCos * mult >> 8) - (negSin * (i * mult >> 8) >> 8);
-        RSDK.SetActivePalette(CLAMP((abs(pos) >> 12) - 24, 0, 7), i + 120, i + 121);
+        int32 pos                    = (negCos * mult >> 8) - (negSin * (i * mult >> 8) >> 8);
+        cache->paletteIDs[lineCount] = CLAMP((abs(pos) >> 12) - paletteOffset, 0, 7);
 
-        scanlines->position.x = (sin * pos - ScreenInfo->center.x * scanlines->deform.x) + camera->position.x;
-        scanlines->position.y = (cos * pos - ScreenInfo->center.x * scanlines->deform.y) + camera->position.y;
+        line->position.x = sin * pos - ScreenInfo->center.x * line->deform.x;
+        line->position.y = cos * pos - ScreenInfo->center.x * line->deform.y;
 
         cosVal += negCos;
-        scanlines++;
+        line++;
+        ++lineCount;
     }
-}
-void PBL_Setup_Scanline_PinballBG(ScanlineInfo *scanlines)
-{
-    RSDK.SetClipBounds(0, 0, 0, ScreenInfo->size.x, 112);
-
-    int32 x       = 116 << 16;
-    int32 centerX = ScreenInfo->center.x;
-    int32 sin     = RSDK.Sin256(32);
-    int32 cos     = RSDK.Cos256(32);
-    int32 timer   = PBL_Setup->scanlineTimer >> 1;
-
-    int32 clr = 0;
-    for (int32 i = 160; i > 40; --i) {
-        x += 0xE000;
-        int32 id = x / (8 * i);
 
-        scanlines->deform.x   = -(cos * id) >> 7;
-        scanlines->deform.y   = sin * id >> 7;
-        scanlines->position.x = timer + sin * id - centerX * scanlines->deform.x;
-        scanlines->position.y = timer + cos * id - centerX * (sin * id >> 7);
+    cache->angle     = camera->angle;
+    cache->rotationY = camera->rotationY;
+    cache->height    = height;
+    cache->center    = ScreenInfo->center;
+    cache->lineCount = lineCount;
+    cache->valid     = true;
+}
 
-        RSDK.SetActivePalette(CLAMP((abs(id) >> 11) - 16, 0, 7), clr, clr + 1);
+void PBL_Setup_DrawCachedScanlines(PBL_ScanlineCache *cache, ScanlineInfo *scanlines, int32 offsetX, int32 offsetY, int32 startLine)
+{
+    ScanlineInfo *line = cache->lines;
+    for (int32 i = 0; i < cache->lineCount; ++i) {
+        scanlines->deform     = line->deform;
+        scanlines->position.x = line->position.x + offsetX;
+        scanlines->position.y = line->position.y + offsetY;
 
         scanlines++;
-        ++clr;
+        line++;
+    }
+
+    // set the palettes in runs rather than line-by-line, the distance fade only changes a handful of times down the screen
+    int32 runStart = 0;
+    for (int32 i = 1; i <= cache->lineCount; ++i) {
+        if (i == cache->lineCount || cache->paletteIDs[i] != cache->paletteIDs[runStart]) {
+            RSDK.SetActivePalette(cache->paletteIDs[runStart], startLine + runStart, startLine + i);
+            runStart = i;
+        }
     }
 }
 
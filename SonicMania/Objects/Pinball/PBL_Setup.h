@@ -4,6 +4,18 @@
 #include "Game.h"
 
 #if MANIA_USE_PLUS
+// Perspective scanlines relative to the camera, only rebuilt when the camera's angle/tilt/height (or the screen size) changes
+typedef struct {
+    bool32 valid;
+    int32 angle;
+    int32 rotationY;
+    int32 height;
+    Vector2 center;
+    int32 lineCount;
+    ScanlineInfo lines[SCREEN_YSIZE];
+    uint8 paletteIDs[SCREEN_YSIZE];
+} PBL_ScanlineCache;
+
 // Object Class
 struct ObjectPBL_Setup {
     RSDK_OBJECT
@@ -20,6 +32,9 @@ struct ObjectPBL_Setup {
     uint8 tableLow;
     uint8 tableHigh;
     uint16 sfxContinue;
+    PBL_ScanlineCache tableLowCache;
+    PBL_ScanlineCache tableHighCache;
+    PBL_ScanlineCache pinballBGCache;
 };
 
 // Entity Class
@@ -52,6 +67,8 @@ void PBL_Setup_Scanline_TableLow(ScanlineInfo *scanlines);
 void PBL_Setup_Scanline_TableHigh(ScanlineInfo *scanlines);
 void PBL_Setup_Scanline_PinballBG(ScanlineInfo *scanlines);
 void PBL_Setup_DrawHook_PrepareDrawingFX(void);
+void PBL_Setup_BuildTableScanlines(PBL_ScanlineCache *cache, EntityPBL_Camera *camera, int32 height, int32 paletteOffset);
+void PBL_Setup_DrawCachedScanlines(PBL_ScanlineCache *cache, ScanlineInfo *scanlines, int32 offsetX, int32 offsetY, int32 startLine);
 
 void PBL_Setup_ExitPinball(void);
 void PBL_Setup_GiveScore(int32 score);
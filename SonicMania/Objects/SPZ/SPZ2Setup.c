@@ -98,8 +98,8 @@ void SPZ2Setup_StageLoad(void)
     SPZ2Setup->aniTiles1 = RSDK.LoadSpriteSheet("SPZ2/AniTiles1.gif", SCOPE_STAGE);
     SPZ2Setup->aniTiles2 = RSDK.LoadSpriteSheet("SPZ2/AniTiles2.gif", SCOPE_STAGE);
 
-    SPZ2Setup->fgLow  = RSDK.GetTileLayer(Zone->fgLayer[0]);
-    SPZ2Setup->fgHigh = RSDK.GetTileLayer(Zone->fgLayer[1]);
+    SPZ2Setup->fgLow  = Zone->fgTileLayer[0];
+    SPZ2Setup->fgHigh = Zone->fgTileLayer[1];
 
     // Sun Attack Deform
     for (int32 i = 0; i < 0x400; ++i) {
@@ -74,6 +74,8 @@ void Beanstalk_Create(void *data)
     self->timer         = 0;
     self->chomperOffset = 0;
     self->state         = Beanstalk_State_Init;
+
+    Beanstalk_SetupBezierLengths();
 }
 
 void Beanstalk_StageLoad(void)
@@ -100,47 +102,51 @@ void Beanstalk_StageLoad(void)
     Beanstalk->hitboxPlant.bottom = 8;
 }
 
-int32 Beanstalk_GetNextNodeDistance(void)
+void Beanstalk_SetupBezierLengths(void)
 {
     RSDK_THIS(Beanstalk);
 
     EntityBeanstalk *next = RSDK_GET_ENTITY(RSDK.GetEntitySlot(self) + 1, Beanstalk);
 
-    if (self->forceEnd || next->classID != Beanstalk->classID)
-        return 0;
+    self->curveLength = 0;
+    if (next->classID == Beanstalk->classID) {
+        int32 thisX = ((self->bezCtrlLength * RSDK.Cos256(self->bezCtrlAngle)) << 9) + self->position.x;
+        int32 thisY = ((self->bezCtrlLength * RSDK.Sin256(self->bezCtrlAngle)) << 9) + self->position.y;
+
+        uint8 angle = (next->bezCtrlAngle + 0x80);
+        int32 nextX = ((next->bezCtrlLength * RSDK.Cos256(angle)) << 9) + next->position.x;
+        int32 nextY = ((next->bezCtrlLength * RSDK.Sin256(angle)) << 9) + next->position.y;
 
-    int32 thisX = ((self->bezCtrlLength * RSDK.Cos256(self->bezCtrlAngle)) << 9) + self->position.x;
-    int32 thisY = ((self->bezCtrlLength * RSDK.Sin256(self->bezCtrlAngle)) << 9) + self->position.y;
+        self->curveLength =
+            MathHelpers_GetBezierCurveLength(self->position.x, self->position.y, thisX, thisY, nextX, nextY, next->position.x, next->position.y);
+    }
 
-    uint8 angle = (next->bezCtrlAngle + 0x80);
-    int32 nextX = ((next->bezCtrlLength * RSDK.Cos256(angle)) << 9) + next->position.x;
-    int32 nextY = ((next->bezCtrlLength * RSDK.Sin256(angle)) << 9) + next->position.y;
-    return MathHelpers_GetBezierCurveLength(self->position.x, self->position.y, thisX, thisY, nextX, nextY, next->position.x, next->position.y)
-           / 0xA0000;
+    // nodes are created in slot order, so the previous node's chain length is already up to date
+    self->chainLength = 0;
+    if (self->type) {
+        EntityBeanstalk *prev = RSDK_GET_ENTITY(RSDK.GetEntitySlot(self) - 1, Beanstalk);
+        if (prev->classID == Beanstalk->classID)
+            self->chainLength = prev->chainLength + prev->curveLength;
+    }
 }
 
-int32 Beanstalk_GetRemainingDistance(void)
+int32 Beanstalk_GetNextNodeDistance(void)
 {
     RSDK_THIS(Beanstalk);
 
-    int32 len = 0;
-    while (self->type) {
-        EntityBeanstalk *prev = RSDK_GET_ENTITY(RSDK.GetEntitySlot(self) - 1, Beanstalk);
-        if (prev->classID != Beanstalk->classID)
-            break;
+    EntityBeanstalk *next = RSDK_GET_ENTITY(RSDK.GetEntitySlot(self) + 1, Beanstalk);
 
-        int32 prevX = ((prev->bezCtrlLength * RSDK.Cos256(prev->bezCtrlAngle)) << 9) + prev->position.x;
-        int32 prevY = ((prev->bezCtrlLength * RSDK.Sin256(prev->bezCtrlAngle)) << 9) + prev->position.y;
+    if (self->forceEnd || next->classID != Beanstalk->classID)
+        return 0;
 
-        uint8 angle = (self->bezCtrlAngle + 0x80);
-        int32 thisX = ((self->bezCtrlLength * RSDK.Cos256(angle)) << 9) + self->position.x;
-        int32 thisY = ((self->bezCtrlLength * RSDK.Sin256(angle)) << 9) + self->position.y;
-        len += MathHelpers_GetBezierCurveLength(prev->position.x, prev->position.y, prevX, prevY, thisX, thisY, self->position.x, self->position.y);
+    return self->curveLength / 0xA0000;
+}
 
-        self = prev;
-    }
+int32 Beanstalk_GetRemainingDistance(void)
+{
+    RSDK_THIS(Beanstalk);
 
-    return len;
+    return self->chainLength;
 }
 
 int32 Beanstalk_GetBezierInc(void)
@@ -152,15 +158,7 @@ int32 Beanstalk_GetBezierInc(void)
     if (self->forceEnd || next->classID != Beanstalk->classID)
         return 0;
 
-    int32 thisX = ((self->bezCtrlLength * RSDK.Cos256(self->bezCtrlAngle)) << 9) + self->position.x;
-    int32 thisY = ((self->bezCtrlLength * RSDK.Sin256(self->bezCtrlAngle)) << 9) + self->position.y;
-
-    uint8 angle = (next->bezCtrlAngle + 0x80);
-    int32 nextX = ((next->bezCtrlLength * RSDK.Cos256(angle)) << 9) + next->position.x;
-    int32 nextY = ((next->bezCtrlLength * RSDK.Sin256(angle)) << 9) + next->position.y;
-    return 0x10000
-           / (MathHelpers_GetBezierCurveLength(self->position.x, self->position.y, thisX, thisY, nextX, nextY, next->position.x, next->position.y)
-              / 0x32000);
+    return 0x10000 / (self->curveLength / 0x32000);
 }
 
 void Beanstalk_DrawNodes(void)
@@ -512,6 +510,9 @@ void Beanstalk_EditorDraw(void)
     self->timer         = 0;
     self->chomperOffset = 0;
 
+    // the nodes may have been moved around since they were created
+    Beanstalk_SetupBezierLengths();
+
     switch (self->type) {
         case BEANSTALK_BEGIN: RSDK.SetSpriteAnimation(Beanstalk->aniFrames, 4, &self->nodeAnimator, true, 9); break;
 
@@ -50,6 +50,8 @@ struct EntityBeanstalk {
     bool32 startGrowth;
     bool32 shown;
     bool32 finished;
+    int32 curveLength;
+    int32 chainLength;
 };
 
 // Object Struct
@@ -69,6 +71,7 @@ void Beanstalk_EditorLoad(void);
 void Beanstalk_Serialize(void);
 
 // Extra Entity Functions
+void Beanstalk_SetupBezierLengths(void);
 int32 Beanstalk_GetNextNodeDistance(void);
 int32 Beanstalk_GetRemainingDistance(void);
 int32 Beanstalk_GetBezierInc(void);
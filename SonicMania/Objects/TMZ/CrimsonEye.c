@@ -668,7 +668,7 @@ void CrimsonEye_StateContainer_MoveElevatorToTMZ2Entry(void)
 
     CrimsonEye->bg2Layer->scrollSpeed = 6 * CrimsonEye->elevatorSpeed;
 
-    TileLayer *moveLayer   = RSDK.GetTileLayer(Zone->moveLayer);
+    TileLayer *moveLayer   = Zone->moveTileLayer;
     moveLayer->scrollSpeed = (CrimsonEye->elevatorSpeed / 24) << 6;
 }
 
@@ -190,7 +190,7 @@ void PopOut_StageLoad(void)
 {
     PopOut->aniFrames = RSDK.LoadSpriteAnimation("TMZ1/PopOut.bin", SCOPE_STAGE);
 
-    if (RSDK.FindObject("Button"))
+    if (Button)
         PopOut->hasButton = true;
 }
 
@@ -289,7 +289,7 @@ void PopOut_EditorDraw(void)
     RSDK_THIS(PopOut);
 
     PopOut->hasButton = false;
-    if (RSDK.FindObject("Button"))
+    if (Button)
         PopOut->hasButton = true;
 
     RSDK.SetSpriteAnimation(PopOut->aniFrames, 0, &self->mountAnimator, true, 0);
@@ -70,7 +70,7 @@ bool32 TMZ1Outro_CutsceneAct1_ElevatorRide(EntityCutsceneSeq *host)
     if (host->timer == 160) {
         Camera_ShakeScreen(0, 0, 6);
         CrimsonEye->targetElevatorSpeed    = -0x10000;
-        TileLayer *moveLayer               = RSDK.GetTileLayer(Zone->moveLayer);
+        TileLayer *moveLayer               = Zone->moveTileLayer;
         moveLayer->drawGroup[0]            = 0;
         moveLayer->scrollPos               = 0x5000000;
         moveLayer->scrollInfo[0].scrollPos = -0x4D00000;
@@ -82,7 +82,7 @@ bool32 TMZ1Outro_CutsceneAct1_ElevatorRide(EntityCutsceneSeq *host)
 
     if (host->timer > 200) {
         if (CrimsonEye->targetElevatorSpeed) {
-            if (RSDK.GetTileLayer(Zone->moveLayer)->scrollPos < 0x2300000)
+            if (Zone->moveTileLayer->scrollPos < 0x2300000)
                 CrimsonEye->targetElevatorSpeed = 0;
         }
         else if (!CrimsonEye->elevatorSpeed) {
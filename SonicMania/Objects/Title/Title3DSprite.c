@@ -13,8 +13,18 @@ void Title3DSprite_Update(void)
 {
     RSDK_THIS(Title3DSprite);
 
-    self->relativePos.x = (-((self->position.y >> 8) * RSDK.Sin1024(TitleBG->angle)) - (self->position.x >> 8) * RSDK.Cos1024(TitleBG->angle)) >> 10;
-    self->relativePos.y = (+((self->position.y >> 8) * RSDK.Cos1024(TitleBG->angle)) - (self->position.x >> 8) * RSDK.Sin1024(TitleBG->angle)) >> 10;
+    // every sprite rotates by the same angle, so only the first one to update each frame needs to look it up
+    if (Title3DSprite->angle != TitleBG->angle) {
+        Title3DSprite->angle  = TitleBG->angle;
+        Title3DSprite->sine   = RSDK.Sin1024(TitleBG->angle);
+        Title3DSprite->cosine = RSDK.Cos1024(TitleBG->angle);
+    }
+
+    int32 x = self->position.x >> 8;
+    int32 y = self->position.y >> 8;
+
+    self->relativePos.x = (-(y * Title3DSprite->sine) - x * Title3DSprite->cosine) >> 10;
+    self->relativePos.y = (+(y * Title3DSprite->cosine) - x * Title3DSprite->sine) >> 10;
 
     self->zdepth = self->relativePos.y;
 }
@@ -61,6 +71,7 @@ void Title3DSprite_StageLoad(void)
     Title3DSprite->islandSize = 0x90;
     Title3DSprite->height     = 0x2800;
     Title3DSprite->baseDepth  = 0xA000;
+    Title3DSprite->angle      = -1;
 }
 
 #if GAME_INCLUDE_EDITOR
@@ -18,6 +18,9 @@ struct ObjectTitle3DSprite {
     int32 height;
     int32 baseDepth;
     uint16 aniFrames;
+    int32 angle;
+    int32 sine;
+    int32 cosine;
 };
 
 // Entity Class
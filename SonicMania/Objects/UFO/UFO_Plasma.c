@@ -20,17 +20,9 @@ void UFO_Plasma_Draw(void)
     int32 y          = (UFO_Setup->timer + 2 * ScreenInfo->position.y) << 14;
     uint8 scanlineID = ((ScreenInfo->position.y >> 1) + 2 * UFO_Setup->timer);
 
-    ScanlineInfo *scanline = UFO_Plasma->scanlines;
-    for (int32 i = 0; i < ScreenInfo->size.y; ++i) {
-        scanline->position.x = TO_FIXED(ScreenInfo->position.x) + UFO_Plasma->scanlineList[scanlineID].position.x;
-        scanline->position.y = y;
-        scanline->deform.x   = UFO_Plasma->scanlineList[scanlineID].deform.x;
-        scanline->deform.y   = 0;
-    
-        y += UFO_Plasma->scanlineList[(scanlineID + 1) & 0xFF].deform.y;
-        scanline++;
-        scanlineID++;
-    }
+    // the table's y positions are running totals, so offset them to start from 'y' at the current phase
+    DrawHelpers_DrawPeriodicScanlines(&UFO_Plasma->scanlineTable, UFO_Plasma->scanlines, scanlineID, ScreenInfo->size.y,
+                                      TO_FIXED(ScreenInfo->position.x), y - UFO_Plasma->scanlineTable.lines[scanlineID].position.y);
 
     RSDK.DrawDeformedSprite(UFO_Plasma->aniFrames, INK_MASKED, 0x100);
     RSDK.SetClipBounds(0, 0, 0, ScreenInfo->size.x, ScreenInfo->size.y);
@@ -53,17 +45,27 @@ void UFO_Plasma_StageLoad(void)
     UFO_Plasma->aniFrames = RSDK.LoadSpriteSheet("SpecialUFO/Plasma.gif", SCOPE_STAGE);
     UFO_Plasma->scanlines = RSDK.GetScanlines();
 
-    int32 angle            = 0;
-    ScanlineInfo *scanline = (ScanlineInfo *)UFO_Plasma->scanlineList;
+    // deform.y only ever feeds the running y position, so each line stores the total of every deform.y after line 0 up to it instead
+    ScanlineInfo period[0x100];
+    int32 angle = 0;
+    int32 total = 0;
     for (int32 i = 0; i < 0x100; ++i) {
-        scanline[i].deform.x   = (RSDK.Sin256(angle >> 1) << 6) + 0x10000;
-        scanline[i].deform.y   = (RSDK.Sin256(angle >> 1) << 5) + 0x10000;
-        scanline[i].position.x = (RSDK.Sin256(angle) << 10) - scanline[i].deform.x * ScreenInfo->center.x;
-        scanline[i].position.y = 0;
+        int32 deformY = (RSDK.Sin256(angle >> 1) << 5) + 0x10000;
+        if (i)
+            total += deformY;
+
+        period[i].deform.x   = (RSDK.Sin256(angle >> 1) << 6) + 0x10000;
+        period[i].deform.y   = 0;
+        period[i].position.x = (RSDK.Sin256(angle) << 10) - period[i].deform.x * ScreenInfo->center.x;
+        period[i].position.y = total;
 
         angle += 2;
     }
 
+    // line 0's deform.y gets added when the table wraps around
+    total += (RSDK.Sin256(0) << 5) + 0x10000;
+    DrawHelpers_SetupPeriodicScanlines(&UFO_Plasma->scanlineTable, period, 0x100, 0, total);
+
     for (int32 b = 0; b < 8; ++b) RSDK.SetPaletteEntry(b, 0xDB, 0x00F000);
 
     RSDK.SetPaletteMask(0x00F000);
@@ -8,7 +8,7 @@ struct ObjectUFO_Plasma {
     RSDK_OBJECT
     bool32 forceEnabled; // unused, this was prolly copied from OOZ/Smog lol
     ScanlineInfo *scanlines;
-    ScanlineInfo scanlineList[0x100];
+    PeriodicScanlines scanlineTable;
     uint16 aniFrames;
     int32 starPostID; // unused, this was prolly copied from OOZ/Smog lol
 };
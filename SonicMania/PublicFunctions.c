@@ -717,6 +717,12 @@ void InitPublicFunctions()
     ADD_PUBLIC_FUNC(CutsceneSeq_LockPlayerControl);
     ADD_PUBLIC_FUNC(CutsceneSeq_LockAllPlayerControl);
     ADD_PUBLIC_FUNC(CutsceneSeq_StartSequence);
+    ADD_PUBLIC_FUNC(CutsceneSeq_CompileTimeline);
+    ADD_PUBLIC_FUNC(CutsceneSeq_StartTimeline);
+    ADD_PUBLIC_FUNC(CutsceneSeq_SetTimelineActorPos);
+    ADD_PUBLIC_FUNC(CutsceneSeq_RunTimeline);
+    ADD_PUBLIC_FUNC(CutsceneSeq_SeekTimeline);
+    ADD_PUBLIC_FUNC(CutsceneSeq_SkipTimeline);
 
     // Cutscene/FXExpandRing
     ADD_PUBLIC_FUNC(FXExpandRing_State_FadeIn);
@@ -1939,6 +1945,9 @@ void InitPublicFunctions()
     ADD_PUBLIC_FUNC(Player_CheckValidState);
     ADD_PUBLIC_FUNC(Player_HandleFlyCarry);
     ADD_PUBLIC_FUNC(Player_HandleSidekickRespawn);
+    ADD_PUBLIC_FUNC(Player_ResetLeaderInputs);
+    ADD_PUBLIC_FUNC(Player_ResetLeaderPositions);
+    ADD_PUBLIC_FUNC(Player_CheckLeadFollower);
     ADD_PUBLIC_FUNC(Player_State_StartSuper);
     ADD_PUBLIC_FUNC(Player_State_Static);
     ADD_PUBLIC_FUNC(Player_State_Ground);
@@ -2123,6 +2132,9 @@ void InitPublicFunctions()
 
     // Global/Soundboard
     ADD_PUBLIC_FUNC(Soundboard_LoadSfx);
+    ADD_PUBLIC_FUNC(Soundboard_AddEmitter);
+    ADD_PUBLIC_FUNC(Soundboard_CheckEmittersNearScreens);
+    ADD_PUBLIC_FUNC(Soundboard_GetNearbyEmitters);
 
     // Global/SpecialRing
     ADD_PUBLIC_FUNC(SpecialRing_DebugSpawn);
@@ -2191,6 +2203,7 @@ void InitPublicFunctions()
 
     // Global/Zone
     ADD_PUBLIC_FUNC(Zone_GetZoneID);
+    ADD_PUBLIC_FUNC(Zone_ResolveSceneIdentity);
     ADD_PUBLIC_FUNC(Zone_StoreEntities);
     ADD_PUBLIC_FUNC(Zone_ReloadStoredEntities);
     ADD_PUBLIC_FUNC(Zone_StartFadeOut);
@@ -2201,6 +2214,10 @@ void InitPublicFunctions()
     ADD_PUBLIC_FUNC(Zone_ReloadScene);
     ADD_PUBLIC_FUNC(Zone_StartTeleportAction);
     ADD_PUBLIC_FUNC(Zone_ApplyWorldBounds);
+    ADD_PUBLIC_FUNC(Zone_CreateTempEntity);
+    ADD_PUBLIC_FUNC(Zone_FindFreeTempSlot);
+    ADD_PUBLIC_FUNC(Zone_IsCosmeticClass);
+    ADD_PUBLIC_FUNC(Zone_CheckPosOnCurrentScreen);
     ADD_PUBLIC_FUNC(Zone_IsZoneLastAct);
 #if MANIA_USE_PLUS
     ADD_PUBLIC_FUNC(Zone_GetListPos_EncoreMode);
@@ -2215,8 +2232,22 @@ void InitPublicFunctions()
     ADD_PUBLIC_FUNC(Zone_State_FadeOut_Destroy);
 #endif
     ADD_PUBLIC_FUNC(Zone_HandlePlayerSwap);
+#if MANIA_USE_PLUS
+    ADD_PUBLIC_FUNC(Zone_StoreSwapState);
+    ADD_PUBLIC_FUNC(Zone_RestoreSwapState);
+    ADD_PUBLIC_FUNC(Zone_PermuteEntities);
+#endif
     ADD_PUBLIC_FUNC(Zone_State_SwapPlayers);
     ADD_PUBLIC_FUNC(Zone_State_HandleSwapFadeIn);
+#if GAME_RECORD_ASSET_MANIFEST
+    ADD_PUBLIC_FUNC(Zone_StartAssetManifest);
+    ADD_PUBLIC_FUNC(Zone_FinishAssetManifest);
+    ADD_PUBLIC_FUNC(Zone_RecordManifestAsset);
+    ADD_PUBLIC_FUNC(Zone_Manifest_LoadSpriteAnimation);
+    ADD_PUBLIC_FUNC(Zone_Manifest_LoadSpriteSheet);
+    ADD_PUBLIC_FUNC(Zone_Manifest_LoadMesh);
+    ADD_PUBLIC_FUNC(Zone_Manifest_GetSfx);
+#endif
 
     // HCZ/Blastoid
     ADD_PUBLIC_FUNC(Blastoid_DebugSpawn);
@@ -2512,6 +2543,9 @@ void InitPublicFunctions()
     ADD_PUBLIC_FUNC(DrawHelpers_DrawArrowAdditive);
     ADD_PUBLIC_FUNC(DrawHelpers_DrawIsocelesTriangle);
     ADD_PUBLIC_FUNC(DrawHelpers_DrawCross);
+    ADD_PUBLIC_FUNC(DrawHelpers_DrawSpriteStrip);
+    ADD_PUBLIC_FUNC(DrawHelpers_SetupPeriodicScanlines);
+    ADD_PUBLIC_FUNC(DrawHelpers_DrawPeriodicScanlines);
     ADD_PUBLIC_FUNC(DrawHelpers_DrawArrow);
     ADD_PUBLIC_FUNC(DrawHelpers_DrawRectOutline);
     ADD_PUBLIC_FUNC(DrawHelpers_DrawArenaBounds);
@@ -2550,6 +2584,8 @@ void InitPublicFunctions()
     ADD_PUBLIC_FUNC(MathHelpers_LerpSin512);
     ADD_PUBLIC_FUNC(MathHelpers_GetBezierPoint);
     ADD_PUBLIC_FUNC(MathHelpers_SquareRoot);
+    ADD_PUBLIC_FUNC(MathHelpers_DistanceBatch);
+    ADD_PUBLIC_FUNC(MathHelpers_NearestOf);
     ADD_PUBLIC_FUNC(MathHelpers_GetBezierCurveLength);
     ADD_PUBLIC_FUNC(MathHelpers_PointInHitbox);
     ADD_PUBLIC_FUNC(MathHelpers_GetInteractionDir);
@@ -2573,6 +2609,11 @@ void InitPublicFunctions()
 
     // Helpers/ParticleHelpers
     ADD_PUBLIC_FUNC(ParticleHelpers_SetupFallingParticles);
+    ADD_PUBLIC_FUNC(ParticleHelpers_InitAmbientParticles);
+    ADD_PUBLIC_FUNC(ParticleHelpers_SpawnAmbientParticle);
+    ADD_PUBLIC_FUNC(ParticleHelpers_RemoveAmbientParticle);
+    ADD_PUBLIC_FUNC(ParticleHelpers_NextAmbientParticle);
+    ADD_PUBLIC_FUNC(ParticleHelpers_StepAmbientParticles);
 
     // Helpers/PlayerHelpers
     ADD_PUBLIC_FUNC(CutsceneRules_IsAct1);
@@ -4808,6 +4849,10 @@ void InitPublicFunctions()
     ADD_PUBLIC_FUNC(Ice_BreakPlayerBlock);
     ADD_PUBLIC_FUNC(Ice_Shatter);
     ADD_PUBLIC_FUNC(Ice_TimeOver_CheckFrozen);
+    ADD_PUBLIC_FUNC(Ice_ClearSolidGrid);
+    ADD_PUBLIC_FUNC(Ice_AddToSolidGrid);
+    ADD_PUBLIC_FUNC(Ice_BuildSolidGrids);
+    ADD_PUBLIC_FUNC(Ice_GetSolidGridCandidates);
     ADD_PUBLIC_FUNC(Ice_UpdateBlockGravity);
     ADD_PUBLIC_FUNC(Ice_State_IceBlock);
     ADD_PUBLIC_FUNC(Ice_State_StartBlockFall);
@@ -5109,6 +5154,8 @@ void InitPublicFunctions()
     ADD_PUBLIC_FUNC(PBL_Setup_Scanline_TableHigh);
     ADD_PUBLIC_FUNC(PBL_Setup_Scanline_PinballBG);
     ADD_PUBLIC_FUNC(PBL_Setup_DrawHook_PrepareDrawingFX);
+    ADD_PUBLIC_FUNC(PBL_Setup_BuildTableScanlines);
+    ADD_PUBLIC_FUNC(PBL_Setup_DrawCachedScanlines);
     ADD_PUBLIC_FUNC(PBL_Setup_ExitPinball);
     ADD_PUBLIC_FUNC(PBL_Setup_GiveScore);
     ADD_PUBLIC_FUNC(PBL_Setup_GiveLife);
@@ -5688,6 +5735,7 @@ void InitPublicFunctions()
     ADD_PUBLIC_FUNC(WeatherTV_State_Outro);
 
     // SSZ/Beanstalk
+    ADD_PUBLIC_FUNC(Beanstalk_SetupBezierLengths);
     ADD_PUBLIC_FUNC(Beanstalk_GetNextNodeDistance);
     ADD_PUBLIC_FUNC(Beanstalk_GetRemainingDistance);
     ADD_PUBLIC_FUNC(Beanstalk_GetBezierInc);